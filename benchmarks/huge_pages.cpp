@@ -0,0 +1,83 @@
+// Times random lookups into a large distance matrix, to measure the effect of
+// backing matrices with transparent huge pages. Build and run from the
+// repository root, once with and once without huge pages:
+//
+//     g++ -O3 -std=c++20 -Ipyvrp/cpp benchmarks/huge_pages.cpp -o huge_pages
+//     ./huge_pages 5000
+//     PYVRP_NO_HUGE_PAGES=1 ./huge_pages 5000
+//
+// The argument is the matrix dimension. With huge pages enabled the reported
+// AnonHugePages should be close to the matrix size, and lookups faster since
+// fewer of them miss the TLB. Where perf is available, the TLB misses can be
+// counted directly with ``perf stat -e dTLB-load-misses ./huge_pages 5000``.
+
+#include "Matrix.h"
+#include "Measure.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using pyvrp::Distance;
+using pyvrp::HugePageAllocator;
+using pyvrp::Matrix;
+
+namespace
+{
+// Returns the amount of anonymous memory backed by huge pages, in kB, or -1
+// when that cannot be determined.
+long anonHugePages()
+{
+    std::ifstream file("/proc/self/smaps_rollup");
+    std::string line;
+    while (std::getline(file, line))
+        if (line.rfind("AnonHugePages:", 0) == 0)
+            return std::stol(line.substr(14));
+
+    return -1;
+}
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    size_t const dim = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 5000;
+    size_t const numLookups = 20'000'000;
+    size_t const numRepeats = 3;
+
+    Matrix<Distance> mat(dim, dim);
+    for (size_t row = 0; row != dim; ++row)
+        for (size_t col = 0; col != dim; ++col)
+            mat(row, col) = row ^ col;
+
+    std::printf("Huge pages: %s\n",
+                HugePageAllocator<Distance>::enabled() ? "on" : "off");
+    std::printf("Matrix size: %zu MB\n", mat.size() * sizeof(Distance) >> 20);
+    std::printf("AnonHugePages: %ld kB\n", anonHugePages());
+
+    std::mt19937_64 rng(42);
+    std::vector<std::pair<size_t, size_t>> lookups(numLookups);
+    for (auto &[row, col] : lookups)
+        row = rng() % dim, col = rng() % dim;
+
+    for (size_t repeat = 0; repeat != numRepeats; ++repeat)
+    {
+        auto const start = std::chrono::steady_clock::now();
+
+        Distance sum = 0;
+        for (auto const &[row, col] : lookups)
+            sum += mat(row, col);
+
+        auto const stop = std::chrono::steady_clock::now();
+        std::chrono::duration<double, std::nano> const elapsed = stop - start;
+        std::printf("%.1f ns per lookup (checksum %lld)\n",
+                    elapsed.count() / numLookups,
+                    static_cast<long long>(sum.get()));
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -7,6 +7,7 @@ from typing import TYPE_CHECKING, Callable, Collection
 from pyvrp.ProgressPrinter import ProgressPrinter
 from pyvrp.Result import Result
 from pyvrp.Statistics import Statistics
+from pyvrp._pyvrp import RoutePool
 
 if TYPE_CHECKING:
     from pyvrp.PenaltyManager import PenaltyManager
@@ -35,6 +36,28 @@ class GeneticAlgorithmParams:
     nb_iter_no_improvement
         Number of iterations without any improvement needed before a restart
         occurs.
+    nb_iter_route_pool
+        Number of iterations between recombinations of the routes in the route
+        pool. The route pool collects the feasible routes of the population's
+        solutions, and periodically selects a subset of those routes that forms
+        a new solution, which is then added to the population. Default 0, which
+        disables the route pool.
+    route_pool_time_limit
+        Time limit (in seconds) for selecting routes from the route pool.
+    nb_iter_granular
+        Number of iterations without improvement after which the search
+        considers more of each client's nearest neighbours. The number of
+        neighbours starts at ``min_granular``, and shrinks again whenever a new
+        best solution is found. This requires a search method that supports
+        adjusting its granular neighbourhood, like
+        :class:`~pyvrp.search.LocalSearch.LocalSearch`, with neighbour lists
+        sorted by proximity (see the ``sort_by_proximity`` argument of
+        :func:`~pyvrp.search.neighbourhood.compute_neighbours`). Default 0,
+        which disables this, so that the search always considers all
+        neighbours.
+    min_granular
+        Minimum number of nearest neighbours the search considers when the
+        granular neighbourhood is adapted.
 
     Attributes
     ----------
@@ -42,16 +65,31 @@ class GeneticAlgorithmParams:
         Probability of repairing an infeasible solution.
     nb_iter_no_improvement
         Number of iterations without improvement before a restart occurs.
+    nb_iter_route_pool
+        Number of iterations between recombinations of the route pool.
+    route_pool_time_limit
+        Time limit for selecting routes from the route pool.
+    nb_iter_granular
+        Number of iterations without improvement before the granular
+        neighbourhood grows.
+    min_granular
+        Minimum number of nearest neighbours considered by the search.
 
     Raises
     ------
     ValueError
         When ``repair_probability`` is not in :math:`[0, 1]`, or
-        ``nb_iter_no_improvement`` is negative.
+        ``nb_iter_no_improvement``, ``nb_iter_route_pool``,
+        ``route_pool_time_limit``, or ``nb_iter_granular`` is negative, or
+        ``min_granular`` is not positive.
     """
 
     repair_probability: float = 0.80
     nb_iter_no_improvement: int = 20_000
+    nb_iter_route_pool: int = 0
+    route_pool_time_limit: float = 0.1
+    nb_iter_granular: int = 0
+    min_granular: int = 10
 
     def __post_init__(self):
         if not 0 <= self.repair_probability <= 1:
@@ -60,6 +98,18 @@ class GeneticAlgorithmParams:
         if self.nb_iter_no_improvement < 0:
             raise ValueError("nb_iter_no_improvement < 0 not understood.")
 
+        if self.nb_iter_route_pool < 0:
+            raise ValueError("nb_iter_route_pool < 0 not understood.")
+
+        if self.route_pool_time_limit < 0:
+            raise ValueError("route_pool_time_limit < 0 not understood.")
+
+        if self.nb_iter_granular < 0:
+            raise ValueError("nb_iter_granular < 0 not understood.")
+
+        if self.min_granular <= 0:
+            raise ValueError("min_granular <= 0 not understood.")
+
 
 class GeneticAlgorithm:
     """
@@ -87,7 +137,8 @@ class GeneticAlgorithm:
     Raises
     ------
     ValueError
-        When the population is empty.
+        When the population is empty, or when the granular neighbourhood should
+        be adapted but the search method does not support that.
     """
 
     def __init__(
@@ -112,6 +163,12 @@ class GeneticAlgorithm:
         if len(initial_solutions) == 0:
             raise ValueError("Expected at least one initial solution.")
 
+        if params.nb_iter_granular > 0 and not hasattr(
+            search_method, "set_num_active_neighbours"
+        ):
+            msg = "Search method does not support adapting its neighbourhood."
+            raise ValueError(msg)
+
         self._data = data
         self._pm = penalty_manager
         self._rng = rng
@@ -125,6 +182,15 @@ class GeneticAlgorithm:
         # infeasible solution (with infinite cost) as the initial best.
         self._best = min(initial_solutions, key=self._cost_evaluator.cost)
 
+        # The route pool collects routes across restarts, so that it can
+        # recombine good routes found at any point during the search.
+        self._route_pool = RoutePool(data)
+
+        # When the granular neighbourhood is adapted, it varies between the
+        # minimum size and the full neighbourhood the search started with.
+        if params.nb_iter_granular > 0:
+            self._max_granular = search_method.num_active_neighbours()
+
     @property
     def _cost_evaluator(self) -> CostEvaluator:
         return self._pm.cost_evaluator()
@@ -168,6 +234,8 @@ class GeneticAlgorithm:
         for sol in self._initial_solutions:
             self._pop.add(sol, self._cost_evaluator)
 
+        self._reset_granular()
+
         while not stop(self._cost_evaluator.cost(self._best)):
             iters += 1
 
@@ -180,6 +248,8 @@ class GeneticAlgorithm:
                 for sol in self._initial_solutions:
                     self._pop.add(sol, self._cost_evaluator)
 
+                self._reset_granular()
+
             curr_best = self._cost_evaluator.cost(self._best)
 
             parents = self._pop.select(self._rng, self._cost_evaluator)
@@ -195,9 +265,20 @@ class GeneticAlgorithm:
             else:
                 iters_no_improvement += 1
 
+            self._adapt_granular(new_best < curr_best, iters_no_improvement)
+
+            if (
+                self._params.nb_iter_route_pool > 0
+                and iters % self._params.nb_iter_route_pool == 0
+            ):
+                self._recombine_routes()
+
             stats.collect_from(self._pop, self._cost_evaluator)
             print_progress.iteration(stats)
 
+        if self._params.nb_iter_granular > 0:  # restore full neighbourhood
+            self._search.set_num_active_neighbours(self._max_granular)
+
         end = time.perf_counter() - start
         res = Result(self._best, stats, iters, end)
 
@@ -232,3 +313,37 @@ class GeneticAlgorithm:
 
             if is_new_best(sol):
                 self._best = sol
+
+    def _reset_granular(self):
+        if self._params.nb_iter_granular > 0:
+            num_neighbours = min(self._params.min_granular, self._max_granular)
+            self._search.set_num_active_neighbours(num_neighbours)
+
+    def _adapt_granular(self, improved: bool, iters_no_improvement: int):
+        # Small neighbourhoods are cheap to search, and suffice while the
+        # search keeps improving. When it stagnates, we grow the neighbourhood
+        # to find the improving moves a small neighbourhood misses.
+        nb_iter_granular = self._params.nb_iter_granular
+        if nb_iter_granular == 0:
+            return
+
+        curr = self._search.num_active_neighbours()
+        if improved:
+            new = max(self._params.min_granular, 2 * curr // 3)
+        elif iters_no_improvement % nb_iter_granular == 0:
+            new = min(self._max_granular, (3 * curr + 1) // 2)
+        else:
+            return
+
+        self._search.set_num_active_neighbours(new)
+
+    def _recombine_routes(self):
+        for sol in self._pop:
+            self._route_pool.add(sol)
+
+        time_limit = self._params.route_pool_time_limit
+        sol = self._route_pool.select(self._best, time_limit)
+
+        if sol is not None:  # then sol is feasible, and improves on the best
+            self._pop.add(sol, self._cost_evaluator)  # solution found so far.
+            self._best = sol
@@ -1,6 +1,7 @@
 from __future__ import annotations
 
-from typing import TYPE_CHECKING, Optional, Union
+from functools import lru_cache
+from typing import TYPE_CHECKING, Callable, Optional, Union
 from warnings import warn
 
 import numpy as np
@@ -69,12 +70,65 @@ class Profile:
     These can be used to model, for example, the road uses of different types
     of vehicles, like trucks, cars, or bicyclists. Each
     :class:`~pyvrp._pyvrp.VehicleType` is associated with a routing profile.
-    """
 
-    edges: list[Edge]
+    .. note::
+
+       Profiles created by :meth:`~Model.from_data` store the complete
+       distance and duration matrices of the data instance, rather than an
+       edge for every pair of locations. These edges are only created when
+       :attr:`~edges` is first accessed.
+    """
 
     def __init__(self):
-        self.edges = []
+        self._edges: list[Edge] = []
+
+        # Dense distance and duration matrices between the given locations, if
+        # any. These are (read-only) views of the data instance's matrices, so
+        # they are not copied until they are modified.
+        self._locs: Optional[list[Union[Client, Depot]]] = None
+        self._distances: Optional[np.ndarray] = None
+        self._durations: Optional[np.ndarray] = None
+
+    @classmethod
+    def _from_matrices(
+        cls,
+        locs: list[Union[Client, Depot]],
+        distances: np.ndarray,
+        durations: np.ndarray,
+    ) -> Profile:
+        profile = cls()
+        profile._locs = locs
+        profile._distances = distances
+        profile._durations = durations
+        return profile
+
+    @property
+    def edges(self) -> list[Edge]:
+        """
+        Returns all edges in this routing profile.
+        """
+        if self._locs is not None:  # first create edges from the matrices
+            locs = self._locs
+            edges = [
+                Edge(
+                    frm=locs[frm],
+                    to=locs[to],
+                    distance=self._distances[frm, to],  # type: ignore
+                    duration=self._durations[frm, to],  # type: ignore
+                )
+                for frm in range(len(locs))
+                for to in range(len(locs))
+            ]
+
+            self._edges = edges + self._edges
+            self._locs = self._distances = self._durations = None
+
+        return self._edges
+
+    @edges.setter
+    def edges(self, edges: list[Edge]):
+        self._edges = edges
+        self._locs = self._distances = self._durations = None
 
     def add_edge(
         self,
@@ -87,9 +141,48 @@ class Profile:
         Adds a new edge to this routing profile.
         """
         edge = Edge(frm, to, distance, duration)
-        self.edges.append(edge)
+        self._edges.append(edge)
         return edge
 
+    def _matrices(
+        self,
+        loc2idx: dict[int, int],
+        base_matrices: Callable[[], tuple[np.ndarray, np.ndarray]],
+    ) -> tuple[np.ndarray, np.ndarray]:
+        """
+        Returns the distance and duration matrices of this profile, for the
+        locations indexed by ``loc2idx``. Pairs of locations without an edge in
+        this profile take their values from the base matrices.
+        """
+        if self._locs is None:
+            distance, duration = (mat.copy() for mat in base_matrices())
+        elif len(self._locs) == len(loc2idx) and all(
+            loc2idx[id(loc)] == idx for idx, loc in enumerate(self._locs)
+        ):
+            # Then the locations are unchanged, and we can use the matrices
+            # directly. They are only copied if we need to modify them.
+            distance = self._distances
+            duration = self._durations
+        else:
+            # Locations were added since the matrices were created. Those new
+            # locations take their values from the base matrices.
+            idcs = [loc2idx[id(loc)] for loc in self._locs]
+            distance, duration = (mat.copy() for mat in base_matrices())
+            distance[np.ix_(idcs, idcs)] = self._distances
+            duration[np.ix_(idcs, idcs)] = self._durations
+
+        if self._edges and not distance.flags.writeable:  # copy on write
+            distance = distance.copy()
+            duration = duration.copy()
+
+        for edge in self._edges:
+            frm = loc2idx[id(edge.frm)]
+            to = loc2idx[id(edge.to)]
+            distance[frm, to] = edge.distance
+            duration[frm, to] = edge.duration
+
+        return distance, duration
+
 
 class Model:
     """
@@ -156,20 +249,16 @@ class Model:
         clients = data.clients()
         locs = depots + clients
 
-        profiles = [Profile() for _ in range(data.num_profiles)]
-        for idx, profile in enumerate(profiles):
-            distances = data.distance_matrix(profile=idx)
-            durations = data.duration_matrix(profile=idx)
-            profile.edges = [
-                Edge(
-                    frm=locs[frm],
-                    to=locs[to],
-                    distance=distances[frm, to],
-                    duration=durations[frm, to],
-                )
-                for frm in range(data.num_locations)
-                for to in range(data.num_locations)
-            ]
+        # The profiles share the data's matrices, rather than storing an edge
+        # for every pair of locations. See the Profile class for details.
+        profiles = [
+            Profile._from_matrices(
+                locs,
+                data.distance_matrix(profile=idx),
+                data.duration_matrix(profile=idx),
+            )
+            for idx in range(data.num_profiles)
+        ]
 
         self = Model()
         self._clients = clients
@@ -382,42 +471,40 @@ class Model:
         locs = self.locations
         loc2idx = {id(loc): idx for idx, loc in enumerate(locs)}
 
-        # First we create the base distance and duration matrices. These are
-        # shared by all routing profiles. If an edge was not specified, we use
-        # a large default value here.
-        base_distance = np.full((len(locs), len(locs)), MAX_VALUE, np.int64)
-        base_duration = np.full((len(locs), len(locs)), MAX_VALUE, np.int64)
-        np.fill_diagonal(base_distance, 0)
-        np.fill_diagonal(base_duration, 0)
+        # The base distance and duration matrices are shared by all routing
+        # profiles. If an edge was not specified, we use a large default value
+        # here. These matrices are only created when needed, since profiles
+        # with dense matrices do not use them.
+        @lru_cache(maxsize=1)
+        def base_matrices() -> tuple[np.ndarray, np.ndarray]:
+            shape = (len(locs), len(locs))
+            base_distance = np.full(shape, MAX_VALUE, np.int64)
+            base_duration = np.full(shape, MAX_VALUE, np.int64)
+            np.fill_diagonal(base_distance, 0)
+            np.fill_diagonal(base_duration, 0)
+
+            for edge in self._edges:
+                frm = loc2idx[id(edge.frm)]
+                to = loc2idx[id(edge.to)]
+                base_distance[frm, to] = edge.distance
+                base_duration[frm, to] = edge.duration
 
-        for edge in self._edges:
-            frm = loc2idx[id(edge.frm)]
-            to = loc2idx[id(edge.to)]
-            base_distance[frm, to] = edge.distance
-            base_duration[frm, to] = edge.duration
+            return base_distance, base_duration
 
         # Now we create the profile-specific distance and duration matrices.
         # These are based on the base matrices.
         distances = []
         durations = []
         for profile in self._profiles:
-            prof_distance = base_distance.copy()
-            prof_duration = base_duration.copy()
-
-            for edge in profile.edges:
-                frm = loc2idx[id(edge.frm)]
-                to = loc2idx[id(edge.to)]
-                prof_distance[frm, to] = edge.distance
-                prof_duration[frm, to] = edge.duration
-
-            distances.append(prof_distance)
-            durations.append(prof_duration)
+            distance, duration = profile._matrices(loc2idx, base_matrices)
+            distances.append(distance)
+            durations.append(duration)
 
         # When the user has not provided any profiles, we create an implicit
         # first profile from the base matrices.
         if not self._profiles:
-            distances = [base_distance]
-            durations = [base_duration]
+            distances = [base_matrices()[0]]
+            durations = [base_matrices()[1]]
 
         return ProblemData(
             self._clients,
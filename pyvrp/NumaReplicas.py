@@ -0,0 +1,86 @@
+from pyvrp._pyvrp import (
+    ProblemData,
+    bind_to_numa_node,
+    current_numa_node,
+    num_numa_nodes,
+    replicate_on_numa_node,
+)
+
+
+class NumaReplicas:
+    """
+    Copies of a data instance, one for each NUMA node of this machine. Solver
+    threads that share a single data instance pay cross-node latency for each
+    matrix lookup when they run on another NUMA node than the one the data is
+    placed on. Instead, each solver thread can bind itself to a node, and use
+    the copy that is placed on that node:
+
+    .. code-block:: python
+
+       replicas = NumaReplicas(data)
+
+       def work(worker: int):
+           local_data = replicas.bind(worker)
+           return solve(local_data, stop=MaxRuntime(10), seed=worker)
+
+       with ThreadPoolExecutor(num_workers) as executor:
+           results = list(executor.map(work, range(num_workers)))
+
+    On machines with a single NUMA node, only the given data instance is used,
+    and binding threads does nothing.
+
+    Parameters
+    ----------
+    data
+        Data instance to replicate.
+    """
+
+    def __init__(self, data: ProblemData):
+        num_nodes = num_numa_nodes()
+
+        if num_nodes == 1:
+            self._replicas = [data]
+        else:
+            self._replicas = [
+                replicate_on_numa_node(data, node) for node in range(num_nodes)
+            ]
+
+    def __len__(self) -> int:
+        """
+        Returns the number of copies, which is the number of NUMA nodes.
+        """
+        return len(self._replicas)
+
+    def __getitem__(self, node: int) -> ProblemData:
+        """
+        Returns the copy that is placed on the given NUMA node.
+        """
+        return self._replicas[node]
+
+    def bind(self, worker: int) -> ProblemData:
+        """
+        Binds the calling thread to a NUMA node, and returns the copy that is
+        placed on that node. Workers are assigned to the nodes in round-robin
+        fashion, so consecutive workers are spread evenly over the nodes.
+
+        Parameters
+        ----------
+        worker
+            Index of the calling worker thread.
+
+        Returns
+        -------
+        ProblemData
+            The data instance the calling thread should use.
+        """
+        node = worker % len(self._replicas)
+        bind_to_numa_node(node)
+        return self._replicas[node]
+
+    def local(self) -> ProblemData:
+        """
+        Returns the copy that is placed on the NUMA node the calling thread is
+        currently running on. Unlike :meth:`~bind`, this does not change where
+        the calling thread may run.
+        """
+        return self._replicas[current_numa_node() % len(self._replicas)]
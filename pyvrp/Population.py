@@ -21,6 +21,11 @@ class Population:
         a look at :mod:`pyvrp.diversity` for available operators.
     params
         Population parameters. If not provided, a default will be used.
+
+    .. note::
+
+       A population must not be modified by multiple threads at the same time.
+       Different populations may be used concurrently, and may share solutions.
     """
 
     def __init__(
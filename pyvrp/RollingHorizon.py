@@ -0,0 +1,563 @@
+from __future__ import annotations
+
+from dataclasses import dataclass, field
+from typing import Callable, Optional
+
+import numpy as np
+
+from pyvrp.GeneticAlgorithm import GeneticAlgorithm
+from pyvrp.PenaltyManager import PenaltyManager
+from pyvrp.Population import Population
+from pyvrp._pyvrp import (
+    Client,
+    Depot,
+    ProblemData,
+    RandomNumberGenerator,
+    Route,
+    Solution,
+    VehicleType,
+)
+from pyvrp.crossover import ordered_crossover as ox
+from pyvrp.crossover import selective_route_exchange as srex
+from pyvrp.diversity import broken_pairs_distance as bpd
+from pyvrp.constants import MAX_VALUE
+from pyvrp.repair import greedy_repair
+from pyvrp.search import LocalSearch, compute_neighbours
+from pyvrp.solve import SolveParams
+from pyvrp.stop import MaxRuntime
+
+# Returns the distance and duration matrices between the given locations.
+MatrixFunction = Callable[[np.ndarray], tuple[np.ndarray, np.ndarray]]
+
+
+@dataclass
+class RollingHorizonParams:
+    """
+    Parameters for the rolling horizon driver.
+
+    Parameters
+    ----------
+    time_limit
+        Time limit (in seconds) for re-optimising the plan in each call to
+        :meth:`~RollingHorizon.replan`. Default 1.
+
+    Attributes
+    ----------
+    time_limit
+        Time limit for re-optimising the plan.
+
+    Raises
+    ------
+    ValueError
+        When ``time_limit`` is negative.
+    """
+
+    time_limit: float = 1.0
+
+    def __post_init__(self):
+        if self.time_limit < 0:
+            raise ValueError("time_limit < 0 not understood.")
+
+
+@dataclass
+class _Vehicle:
+    vehicle_type: int  # index of the vehicle's type
+    position: int  # location of the vehicle's last dispatched stop
+    available: int  # time at which the vehicle finishes its dispatched stops
+    start: int = 0  # time at which the vehicle left the depot
+    distance: int = 0  # distance travelled to the dispatched stops
+    picked_up: int = 0  # pickup amount of the dispatched stops
+    coords: tuple[int, int] = (0, 0)  # coordinates of the last dispatched stop
+    stops: list[int] = field(default_factory=list)  # dispatched stops
+    on_board: set[int] = field(default_factory=set)  # deliveries carried
+
+    @property
+    def dispatched(self) -> bool:
+        return len(self.stops) > 0
+
+
+class RollingHorizon:
+    """
+    Rolling horizon driver for instances where clients arrive over time. The
+    driver maintains a current plan. Each call to :meth:`~replan` freezes the
+    stops in that plan that have been dispatched, and then re-optimises the
+    remaining plan for all clients that have not yet been dispatched.
+
+    Locations are identified by integer indices into the matrices returned by
+    the ``matrices`` function. The depots have indices ``0``, ...,
+    ``len(depots) - 1``, and clients are given their index when they are added
+    using :meth:`~add_clients`.
+
+    The re-optimised instance only contains the depots, the vehicles' current
+    positions, and the clients that have not yet been dispatched. A vehicle
+    that has been dispatched starts its remaining route from the location of
+    its last dispatched stop, once it has finished serving that stop, with the
+    capacity, duration, and distance that remain. The time needed for each
+    re-plan is thus bounded by the number of outstanding clients, rather than
+    the total number of clients that arrived so far.
+
+    .. note::
+
+       Goods are loaded at the depot. A dispatched vehicle carries the
+       deliveries of the clients that were on its route when it left, and
+       nothing else. In the re-optimised instance, it may thus only serve the
+       outstanding delivery clients whose goods it carries, and no other
+       vehicle may serve those clients. This is enforced by giving each
+       dispatched vehicle its own routing profile, in which edges to the
+       delivery clients it may not serve have a prohibitively large distance
+       and duration. Clients that only have a pickup amount may be served by
+       any vehicle. The remaining capacity of a dispatched vehicle accounts
+       for the amounts picked up at its dispatched stops, and conservatively
+       reserves room for the goods of optional clients it carries, since
+       those stay on board when such a client is not visited.
+
+    Parameters
+    ----------
+    depots
+        Depots.
+    vehicle_types
+        Vehicle types. These must all use the first routing profile.
+    matrices
+        Function that returns the distance and duration matrices between the
+        given array of location indices.
+    params
+        Rolling horizon parameters. If not provided, a default will be used.
+    solve_params
+        Solver parameters to use when re-optimising the plan. If not provided,
+        a default will be used.
+    seed
+        Seed value to use for the random number stream. Default 0.
+
+    Raises
+    ------
+    ValueError
+        When a vehicle type does not use the first routing profile.
+    """
+
+    def __init__(
+        self,
+        depots: list[Depot],
+        vehicle_types: list[VehicleType],
+        matrices: MatrixFunction,
+        params: RollingHorizonParams = RollingHorizonParams(),
+        solve_params: SolveParams = SolveParams(),
+        seed: int = 0,
+    ):
+        if any(veh_type.profile != 0 for veh_type in vehicle_types):
+            raise ValueError("Vehicle types must use the first profile.")
+
+        self._depots = depots
+        self._vehicle_types = vehicle_types
+        self._matrices = matrices
+        self._params = params
+        self._solve_params = solve_params
+        self._rng = RandomNumberGenerator(seed=seed)
+
+        self._vehicles = [
+            _Vehicle(idx, veh_type.depot, veh_type.tw_early)
+            for idx, veh_type in enumerate(vehicle_types)
+            for _ in range(veh_type.num_available)
+        ]
+
+        for vehicle in self._vehicles:
+            depot = depots[vehicle.position]
+            vehicle.coords = (depot.x, depot.y)
+
+        self._clients: dict[int, Client] = {}  # clients not yet dispatched
+
+        # The current plan, the instance it solves, and the population of the
+        # last re-optimisation. Each client in the instance corresponds to a
+        # location index in client_ids, and each vehicle type to one or more
+        # vehicles in type_vehicles.
+        self._data: Optional[ProblemData] = None
+        self._plan: Optional[Solution] = None
+        self._population: list[Solution] = []
+        self._client_ids: list[int] = []
+        self._type_vehicles: list[list[int]] = []
+
+    @property
+    def data(self) -> Optional[ProblemData]:
+        """
+        Returns the instance solved by the current plan, if any.
+        """
+        return self._data
+
+    @property
+    def plan(self) -> Optional[Solution]:
+        """
+        Returns the current plan, if any.
+        """
+        return self._plan
+
+    def dispatched(self) -> list[list[int]]:
+        """
+        Returns the location indices of the dispatched stops of each vehicle,
+        in the order in which they are visited.
+        """
+        return [list(vehicle.stops) for vehicle in self._vehicles]
+
+    def add_clients(self, ids: list[int], clients: list[Client]):
+        """
+        Adds newly arrived clients. These are included in the plan at the next
+        call to :meth:`~replan`.
+
+        Parameters
+        ----------
+        ids
+            Location index of each client.
+        clients
+            Clients to add.
+
+        Raises
+        ------
+        ValueError
+            When the number of indices and clients differ, when an index is
+            repeated or that of a depot or an outstanding client, or when a
+            client is part of a client group.
+        """
+        if len(ids) != len(clients):
+            raise ValueError("Number of indices and clients must match.")
+
+        if len(set(ids)) != len(ids):
+            raise ValueError("Location indices must be unique.")
+
+        for idx, client in zip(ids, clients):
+            if idx < len(self._depots) or idx in self._clients:
+                raise ValueError(f"Location index {idx} is already in use.")
+
+            if client.group is not None:
+                raise ValueError("Client groups are not supported.")
+
+        self._clients.update(zip(ids, clients))
+
+    def replan(self, now: int) -> Solution:
+        """
+        Freezes the stops of the current plan that the vehicles have left for
+        at or before the given time, and re-optimises the plan for all other
+        clients. The previous population is reused as the starting point for
+        the re-optimisation.
+
+        Parameters
+        ----------
+        now
+            The current time.
+
+        Returns
+        -------
+        Solution
+            The new plan. Routes start no earlier than the current time, from
+            the depot or the vehicle's last dispatched stop.
+        """
+        if self._plan is not None:
+            self._freeze(now)
+
+        data, client_ids, type_vehicles = self._instance(now)
+
+        if data.num_clients == 0:
+            plan = Solution(data, [])
+            population = []
+        else:
+            initial = self._initial_solutions(data, client_ids, type_vehicles)
+
+            params = self._solve_params
+            neighbours = compute_neighbours(
+                data,
+                params.neighbourhood,
+                sort_by_proximity=params.genetic.nb_iter_granular > 0,
+            )
+            adaptive = params.adaptive_operators
+            ls = LocalSearch(data, self._rng, neighbours, adaptive)
+
+            for node_op in params.node_ops:
+                ls.add_node_operator(node_op(data))
+
+            for route_op in params.route_ops:
+                ls.add_route_operator(route_op(data))
+
+            pm = PenaltyManager(params.penalty)
+            pop = Population(bpd, params.population)
+            crossover = srex if data.num_vehicles > 1 else ox
+
+            gen_args = (data, pm, self._rng, pop, ls, crossover, initial)
+            algo = GeneticAlgorithm(*gen_args, params.genetic)  # type: ignore
+            stop = MaxRuntime(self._params.time_limit)
+            res = algo.run(stop, collect_stats=False)
+
+            plan = res.best
+            population = list(pop)
+
+        self._data = data
+        self._plan = plan
+        self._population = population
+        self._client_ids = client_ids
+        self._type_vehicles = type_vehicles
+
+        return plan
+
+    def _freeze(self, now: int):
+        assert self._data is not None and self._plan is not None
+
+        data = self._data
+        num_routes = [0] * data.num_vehicle_types
+
+        for route in self._plan.routes():
+            veh_type = route.vehicle_type()
+            veh_idx = self._type_vehicles[veh_type][num_routes[veh_type]]
+            vehicle = self._vehicles[veh_idx]
+            num_routes[veh_type] += 1
+
+            profile = data.vehicle_type(veh_type).profile
+            distances = data.distance_matrix(profile)
+            durations = data.duration_matrix(profile)
+
+            # The vehicle leaves each location directly after serving it. A
+            # stop is dispatched once the vehicle has left for it.
+            time = route.start_time()
+            prev = route.depot()
+            for client in route.visits():
+                if time > now:
+                    break
+
+                idx = self._client_ids[client - data.num_depots]
+                stop = self._clients.pop(idx)
+
+                if not vehicle.dispatched:
+                    # The vehicle leaves the depot with the deliveries of all
+                    # clients that are on its route at that time.
+                    vehicle.start = time
+                    vehicle.on_board = {
+                        self._client_ids[visit - data.num_depots]
+                        for visit in route.visits()
+                        if data.location(visit).delivery > 0
+                    }
+
+                arrival = time + int(durations[prev, client])
+                time = max(arrival, stop.tw_early) + stop.service_duration
+
+                vehicle.position = idx
+                vehicle.available = time
+                vehicle.distance += int(distances[prev, client])
+                vehicle.picked_up += stop.pickup
+                vehicle.on_board.discard(idx)
+                vehicle.coords = (stop.x, stop.y)
+                vehicle.stops.append(idx)
+                prev = client
+
+    def _instance(
+        self, now: int
+    ) -> tuple[ProblemData, list[int], list[list[int]]]:
+        depots = list(self._depots)
+        from_ids = list(range(len(depots)))  # location index when leaving
+        to_ids = list(range(len(depots)))  # location index when arriving
+
+        vehicle_types = []
+        type_vehicles = []
+
+        # Vehicles that have not yet been dispatched start from their depot,
+        # but no earlier than the current time.
+        for type_idx, veh_type in enumerate(self._vehicle_types):
+            idle = [
+                idx
+                for idx, vehicle in enumerate(self._vehicles)
+                if vehicle.vehicle_type == type_idx and not vehicle.dispatched
+            ]
+
+            if idle:
+                tw_early = min(max(veh_type.tw_early, now), veh_type.tw_late)
+                new_type = _replace(
+                    veh_type, num_available=len(idle), tw_early=tw_early
+                )
+
+                vehicle_types.append(new_type)
+                type_vehicles.append(idle)
+
+        # Vehicles that have been dispatched start from a separate depot at
+        # their last dispatched stop, and return to their own depot. Each such
+        # vehicle uses its own profile, which is constructed below.
+        dispatched = []
+        for idx, vehicle in enumerate(self._vehicles):
+            if not vehicle.dispatched:
+                continue
+
+            dispatched.append(vehicle)
+
+            veh_type = self._vehicle_types[vehicle.vehicle_type]
+            home = self._depots[veh_type.depot]
+            available = max(vehicle.available, now)
+            tw_early = min(available, home.tw_late, veh_type.tw_late)
+
+            depots.append(Depot(*vehicle.coords, tw_early, home.tw_late))
+            from_ids.append(vehicle.position)
+            to_ids.append(veh_type.depot)
+
+            # Pickups at the dispatched stops remain on board until the
+            # vehicle returns to its depot. So do the goods of optional
+            # clients on board that are not visited, so we reserve room for
+            # those as well.
+            carried = [self._clients.get(idx) for idx in vehicle.on_board]
+            optional = [
+                client.delivery
+                for client in carried
+                if client is not None and not client.required
+            ]
+
+            elapsed = available - vehicle.start
+            load = vehicle.picked_up + sum(optional)
+            vehicle_types.append(
+                _replace(
+                    veh_type,
+                    num_available=1,
+                    capacity=max(veh_type.capacity - load, 0),
+                    depot=len(depots) - 1,
+                    tw_early=tw_early,
+                    max_duration=max(veh_type.max_duration - elapsed, 0),
+                    max_distance=max(
+                        veh_type.max_distance - vehicle.distance, 0
+                    ),
+                    fixed_cost=0,  # the vehicle is already in use
+                    profile=len(dispatched),
+                )
+            )
+            type_vehicles.append([idx])
+
+        client_ids = list(self._clients.keys())
+        from_ids += client_ids
+        to_ids += client_ids
+
+        ids = np.unique(np.concatenate([from_ids, to_ids]))
+        distances, durations = self._matrices(ids)
+        rows = np.searchsorted(ids, from_ids)
+        cols = np.searchsorted(ids, to_ids)
+
+        dist_mat = np.asarray(distances)[np.ix_(rows, cols)]
+        dur_mat = np.asarray(durations)[np.ix_(rows, cols)]
+        np.fill_diagonal(dist_mat, 0)
+        np.fill_diagonal(dur_mat, 0)
+
+        # Vehicles that have not been dispatched may not serve the clients
+        # whose goods are on board of a dispatched vehicle, and a dispatched
+        # vehicle may only serve the delivery clients whose goods it carries.
+        # Like the backhaul instances in read(), edges to clients that may not
+        # be served have a prohibitively large distance and duration.
+        column = {idx: len(depots) + pos for pos, idx in enumerate(client_ids)}
+        deliveries = {
+            idx for idx, client in self._clients.items() if client.delivery > 0
+        }
+
+        forbidden = [set().union(*(veh.on_board for veh in dispatched))]
+        forbidden += [deliveries - vehicle.on_board for vehicle in dispatched]
+
+        dist_mats = []
+        dur_mats = []
+        for excluded in forbidden:
+            targets = [column[idx] for idx in excluded if idx in column]
+
+            profile_dist = dist_mat.copy()
+            profile_dist[:, targets] = MAX_VALUE
+            np.fill_diagonal(profile_dist, 0)
+            dist_mats.append(profile_dist)
+
+            profile_dur = dur_mat.copy()
+            profile_dur[:, targets] = MAX_VALUE
+            np.fill_diagonal(profile_dur, 0)
+            dur_mats.append(profile_dur)
+
+        clients = list(self._clients.values())
+        data = ProblemData(
+            clients, depots, vehicle_types, dist_mats, dur_mats
+        )
+
+        return data, client_ids, type_vehicles
+
+    def _initial_solutions(
+        self,
+        data: ProblemData,
+        client_ids: list[int],
+        type_vehicles: list[list[int]],
+    ) -> list[Solution]:
+        # Maps the solutions of the previous population to the new instance.
+        # Dispatched clients are removed from the routes, and each route is
+        # assigned to the new vehicle type of the same vehicle. Clients that
+        # arrived since are then inserted using greedy repair.
+        num_depots = data.num_depots
+        new_client = {
+            idx: num_depots + pos for pos, idx in enumerate(client_ids)
+        }
+        new_type = {
+            veh_idx: type_idx
+            for type_idx, vehicles in enumerate(type_vehicles)
+            for veh_idx in vehicles
+        }
+
+        pm = PenaltyManager(self._solve_params.penalty)
+        solutions = []
+
+        for sol in self._population:
+            num_routes = [0] * len(self._type_vehicles)
+            num_used = [0] * len(type_vehicles)
+            routes = []
+            planned = set()
+
+            for route in sol.routes():
+                veh_type = route.vehicle_type()
+                veh_idx = self._type_vehicles[veh_type][num_routes[veh_type]]
+                num_routes[veh_type] += 1
+
+                type_idx = new_type[veh_idx]
+                if num_used[type_idx] == len(type_vehicles[type_idx]):
+                    continue  # vehicle type has no vehicles left
+
+                visits = []
+                for client in route.visits():
+                    idx = self._client_ids[client - num_depots]
+                    if idx in new_client:  # then not dispatched
+                        visits.append(new_client[idx])
+
+                if visits:
+                    num_used[type_idx] += 1
+                    routes.append(Route(data, visits, type_idx))
+                    planned.update(visits)
+
+            unplanned = [
+                client
+                for client in range(num_depots, data.num_locations)
+                if client not in planned
+            ]
+
+            if unplanned and not routes:  # then there is nothing to repair
+                continue
+
+            if unplanned:
+                cost_eval = pm.cost_evaluator()
+                routes = greedy_repair(routes, unplanned, data, cost_eval)
+
+            solutions.append(Solution(data, routes))
+
+        min_size = self._solve_params.population.min_pop_size
+        while len(solutions) < max(min_size, 1):
+            solutions.append(Solution.make_random(data, self._rng))
+
+        return solutions
+
+
+def _replace(veh_type: VehicleType, **kwargs) -> VehicleType:
+    """
+    Returns a copy of the given vehicle type, with the given fields replaced.
+    """
+    fields = dict(
+        num_available=veh_type.num_available,
+        capacity=veh_type.capacity,
+        depot=veh_type.depot,
+        tw_early=veh_type.tw_early,
+        tw_late=veh_type.tw_late,
+        max_duration=veh_type.max_duration,
+        max_distance=veh_type.max_distance,
+        fixed_cost=veh_type.fixed_cost,
+        unit_distance_cost=veh_type.unit_distance_cost,
+        unit_duration_cost=veh_type.unit_duration_cost,
+        profile=veh_type.profile,
+        name=veh_type.name,
+    )
+
+    fields.update(kwargs)
+    return VehicleType(**fields)
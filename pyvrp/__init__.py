@@ -3,22 +3,37 @@ from .GeneticAlgorithm import GeneticAlgorithmParams as GeneticAlgorithmParams
 from .Model import Edge as Edge
 from .Model import Model as Model
 from .Model import Profile as Profile
+from .NumaReplicas import NumaReplicas as NumaReplicas
 from .PenaltyManager import PenaltyManager as PenaltyManager
 from .PenaltyManager import PenaltyParams as PenaltyParams
 from .Population import Population as Population
 from .Population import PopulationParams as PopulationParams
 from .Result import Result as Result
+from .RollingHorizon import RollingHorizon as RollingHorizon
+from .RollingHorizon import RollingHorizonParams as RollingHorizonParams
 from .Statistics import Statistics as Statistics
 from ._pyvrp import Client as Client
 from ._pyvrp import ClientGroup as ClientGroup
 from ._pyvrp import CostEvaluator as CostEvaluator
 from ._pyvrp import Depot as Depot
 from ._pyvrp import DynamicBitset as DynamicBitset
+from ._pyvrp import PlanEvaluation as PlanEvaluation
 from ._pyvrp import ProblemData as ProblemData
 from ._pyvrp import RandomNumberGenerator as RandomNumberGenerator
+from ._pyvrp import RoadGraph as RoadGraph
 from ._pyvrp import Route as Route
+from ._pyvrp import RoutePool as RoutePool
 from ._pyvrp import Solution as Solution
 from ._pyvrp import VehicleType as VehicleType
+from ._pyvrp import bind_to_numa_node as bind_to_numa_node
+from ._pyvrp import current_numa_node as current_numa_node
+from ._pyvrp import evaluate_plans as evaluate_plans
+from ._pyvrp import lower_bound as lower_bound
+from ._pyvrp import num_numa_nodes as num_numa_nodes
+from ._pyvrp import numa_node_cpus as numa_node_cpus
+from ._pyvrp import replicate_on_numa_node as replicate_on_numa_node
+from .multilevel import MultilevelParams as MultilevelParams
+from .multilevel import solve_multilevel as solve_multilevel
 from .read import read as read
 from .read import read_solution as read_solution
 from .show_versions import show_versions as show_versions
@@ -145,6 +145,17 @@ class ProblemData:
         duration_matrices: Optional[list[np.ndarray[int]]] = None,
         groups: Optional[list[ClientGroup]] = None,
     ) -> ProblemData: ...
+    def x(self) -> np.ndarray[int]: ...
+    def y(self) -> np.ndarray[int]: ...
+    def delivery(self) -> np.ndarray[int]: ...
+    def pickup(self) -> np.ndarray[int]: ...
+    def service_duration(self) -> np.ndarray[int]: ...
+    def tw_early(self) -> np.ndarray[int]: ...
+    def tw_late(self) -> np.ndarray[int]: ...
+    def release_time(self) -> np.ndarray[int]: ...
+    def prize(self) -> np.ndarray[int]: ...
+    def required(self) -> np.ndarray[bool]: ...
+    def group_membership(self) -> np.ndarray[int]: ...
     def centroid(self) -> tuple[float, float]: ...
     def group(self, group: int) -> ClientGroup: ...
     def vehicle_type(self, vehicle_type: int) -> VehicleType: ...
@@ -274,6 +285,86 @@ class SubPopulation:
     def __iter__(self) -> Iterator[SubPopulationItem]: ...
     def __len__(self) -> int: ...
 
+class RoutePool:
+    def __init__(self, data: ProblemData, max_size: int = 1_000) -> None: ...
+    def add(self, solution: Solution) -> None: ...
+    def clear(self) -> None: ...
+    def select(
+        self, incumbent: Solution, time_limit: float = 0.1
+    ) -> Optional[Solution]: ...
+    def __len__(self) -> int: ...
+
+class RoadGraph:
+    def __init__(self, path: str, max_cached_rows: int = 1_000) -> None: ...
+    def num_nodes(self) -> int: ...
+    def num_locations(self) -> int: ...
+    def num_cached_rows(self) -> int: ...
+    def set_locations(self, nodes: list[int]) -> None: ...
+    def add_location(self, node: int) -> int: ...
+    def nearest_node(self, x: int, y: int) -> int: ...
+    def row(
+        self, location: int
+    ) -> tuple[np.ndarray[int], np.ndarray[int]]: ...
+    def matrices(
+        self, num_threads: int = 1
+    ) -> tuple[np.ndarray[int], np.ndarray[int]]: ...
+
+class PlanEvaluation:
+    @property
+    def route_distance(self) -> np.ndarray[int]: ...
+    @property
+    def route_duration(self) -> np.ndarray[int]: ...
+    @property
+    def route_excess_load(self) -> np.ndarray[int]: ...
+    @property
+    def route_time_warp(self) -> np.ndarray[int]: ...
+    @property
+    def route_excess_distance(self) -> np.ndarray[int]: ...
+    @property
+    def route_cost(self) -> np.ndarray[int]: ...
+    @property
+    def route_feasible(self) -> np.ndarray[bool]: ...
+    @property
+    def distance(self) -> np.ndarray[int]: ...
+    @property
+    def duration(self) -> np.ndarray[int]: ...
+    @property
+    def distance_cost(self) -> np.ndarray[int]: ...
+    @property
+    def duration_cost(self) -> np.ndarray[int]: ...
+    @property
+    def fixed_vehicle_cost(self) -> np.ndarray[int]: ...
+    @property
+    def uncollected_prizes(self) -> np.ndarray[int]: ...
+    @property
+    def excess_load(self) -> np.ndarray[int]: ...
+    @property
+    def time_warp(self) -> np.ndarray[int]: ...
+    @property
+    def excess_distance(self) -> np.ndarray[int]: ...
+    @property
+    def penalised_cost(self) -> np.ndarray[int]: ...
+    @property
+    def cost(self) -> np.ndarray[int]: ...
+    @property
+    def feasible(self) -> np.ndarray[bool]: ...
+
+def evaluate_plans(
+    data: ProblemData,
+    cost_evaluator: CostEvaluator,
+    visits: np.ndarray[int],
+    route_offsets: np.ndarray[int],
+    vehicle_types: np.ndarray[int],
+    plan_offsets: np.ndarray[int],
+    num_threads: int = 1,
+) -> PlanEvaluation: ...
+def lower_bound(data: ProblemData) -> int: ...
+def num_numa_nodes() -> int: ...
+def numa_node_cpus(node: int) -> list[int]: ...
+def current_numa_node() -> int: ...
+def bind_to_numa_node(node: int) -> None: ...
+def replicate_on_numa_node(data: ProblemData, node: int) -> ProblemData: ...
+
 class SubPopulationItem:
     @property
     def fitness(self) -> float: ...
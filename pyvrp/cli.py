@@ -1,5 +1,6 @@
 import argparse
-from functools import partial
+import tempfile
+from functools import lru_cache, partial
 from pathlib import Path
 from typing import Optional
 
@@ -64,18 +65,27 @@ def write_solution(where: Path, data: ProblemData, result: Result):
         fh.write(f"Cost: {round(result.cost(), 2)}\n")
 
 
+# Each worker process keeps the most recently read instance. This is a
+# best-effort saving only: jobs of the same instance are queued consecutively,
+# but which worker picks up which job is not controlled, so an instance may
+# still be read by several workers, or more than once by the same worker.
+_read = lru_cache(maxsize=1)(read)
+
+
 def _solve(
     data_loc: Path,
-    round_func: str,
     seed: int,
+    round_func: str,
     max_runtime: float,
     max_iterations: int,
     no_improvement: int,
     per_client: bool,
     stats_dir: Optional[Path],
     sol_dir: Optional[Path],
+    seed_in_name: bool = False,
+    neighbourhood_cache: Optional[Path] = None,
     **kwargs,
-) -> tuple[str, str, float, int, float]:
+) -> tuple[str, int, str, float, int, float]:
     """
     Solves a single VRPLIB instance.
 
@@ -83,11 +93,11 @@ def _solve(
     ----------
     data_loc
         Filesystem location of the VRPLIB instance.
+    seed
+        Seed to use for the RNG.
     round_func
         Rounding function to use for rounding non-integral data. Argument is
         passed to ``read()``.
-    seed
-        Seed to use for the RNG.
     max_runtime
         Maximum runtime (in seconds) for solving.
     max_iterations
@@ -100,19 +110,28 @@ def _solve(
         The directory to write runtime statistics to.
     sol_dir
         The directory to write the best found solutions to.
+    seed_in_name
+        Whether to add the seed to the names of the statistics and solution
+        files. Default ``False``.
+    neighbourhood_cache
+        Directory in which to cache neighbourhoods, when the configuration does
+        not already specify such a directory. Default ``None``.
 
     Returns
     -------
-    tuple[str, str, float, int, float]
-        A tuple containing the instance name, whether the solution is feasible,
-        the solution cost, the number of iterations, and the runtime.
+    tuple[str, int, str, float, int, float]
+        A tuple containing the instance name, the seed, whether the solution is
+        feasible, the solution cost, the number of iterations, and the runtime.
     """
     if kwargs.get("config_loc"):
         params = SolveParams.from_file(kwargs["config_loc"])
     else:
         params = SolveParams()
 
-    data = read(data_loc, round_func)
+    if params.neighbourhood_cache is None and neighbourhood_cache is not None:
+        params = params.replace(neighbourhood_cache=neighbourhood_cache)
+
+    data = _read(data_loc, round_func)
 
     if per_client:
         max_runtime *= data.num_clients
@@ -129,17 +148,19 @@ def _solve(
 
     result = solve(data, stop, seed, bool(stats_dir), params=params)
     instance_name = data_loc.stem
+    file_name = f"{instance_name}-{seed}" if seed_in_name else instance_name
 
     if stats_dir:
         stats_dir.mkdir(parents=True, exist_ok=True)  # just in case
-        result.stats.to_csv(stats_dir / (instance_name + ".csv"))
+        result.stats.to_csv(stats_dir / (file_name + ".csv"))
 
     if sol_dir:
         sol_dir.mkdir(parents=True, exist_ok=True)  # just in case
-        write_solution(sol_dir / (instance_name + ".sol"), data, result)
+        write_solution(sol_dir / (file_name + ".sol"), data, result)
 
     return (
         instance_name,
+        seed,
         "Y" if result.is_feasible() else "N",
         round(result.cost(), 2),
         result.num_iterations,
@@ -147,30 +168,63 @@ def _solve(
     )
 
 
-def benchmark(instances: list[Path], num_procs: int, **kwargs):
+def benchmark(
+    instances: list[Path],
+    seed: list[int],
+    num_procs: int,
+    **kwargs,
+):
     """
-    Solves a list of instances, and prints a table with the results. Any
-    additional keyword arguments are passed to ``solve()``.
+    Solves a list of instances with each of the given seeds, and prints a
+    table with the results. Any additional keyword arguments are passed to
+    ``solve()``.
+
+    Jobs are scheduled largest instance first, using the file size as a proxy
+    for the instance size. Each job is handed to the first available process,
+    so that one large instance does not hold up the rest of the batch. The
+    seeds of the same instance are queued consecutively, which often, but not
+    always, lets a process reuse an instance it has just read. Neighbourhoods
+    are cached on disk, and thus only computed once per instance.
 
     Parameters
     ----------
     instances
         Paths to the VRPLIB instances to solve.
+    seed
+        Seeds to solve each instance with.
     num_procs
         Number of processors to use. Default 1.
     kwargs
         Any additional keyword arguments to pass to the solving function.
     """
-    args = sorted(instances)
-    func = partial(_solve, **kwargs)
-
-    if len(instances) == 1:
-        res = [func(args[0])]
-    else:
-        res = process_map(func, args, max_workers=num_procs, unit="instance")
-
+    sizes = {loc: loc.stat().st_size for loc in instances}
+    locs = sorted(instances, key=lambda loc: (-sizes[loc], loc))
+    seeds = sorted(seed)
+    jobs = [(loc, seed) for loc in locs for seed in seeds]
+
+    with tempfile.TemporaryDirectory() as cache_dir:
+        func = partial(
+            _solve,
+            seed_in_name=len(seed) > 1,
+            neighbourhood_cache=Path(cache_dir),
+            **kwargs,
+        )
+
+        if len(jobs) == 1:
+            res = [func(*jobs[0])]
+        else:
+            res = process_map(
+                func,
+                *zip(*jobs),
+                max_workers=num_procs,
+                chunksize=1,
+                unit="run",
+            )
+
+    res = sorted(res, key=lambda row: (row[0], row[1]))  # by instance, seed
     dtypes = [
         ("inst", "U37"),
+        ("seed", int),
         ("ok", "U1"),
         ("obj", float),
         ("iters", int),
@@ -178,7 +232,7 @@ def benchmark(instances: list[Path], num_procs: int, **kwargs):
     ]
 
     data = np.asarray(res, dtype=dtypes)
-    headers = ["Instance", "OK", "Obj.", "Iters. (#)", "Time (s)"]
+    headers = ["Instance", "Seed", "OK", "Obj.", "Iters. (#)", "Time (s)"]
 
     print("\n", tabulate(headers, data), "\n", sep="")
     print(f"     Avg. objective: {data['obj'].mean():.0f}")
@@ -223,8 +277,11 @@ def main():
     """
     parser.add_argument("--config_loc", type=Path, help=msg)
 
-    msg = "Seed to use for reproducible results."
-    parser.add_argument("--seed", required=True, type=int, help=msg)
+    msg = """
+    One or more seeds to use for reproducible results. Each instance is solved
+    once with each seed.
+    """
+    parser.add_argument("--seed", required=True, nargs="+", type=int, help=msg)
 
     msg = "Number of processors to use for solving instances. Default 1."
     parser.add_argument("--num_procs", type=int, default=1, help=msg)
@@ -47,7 +47,8 @@ concept DeltaCostEvaluatable = requires(T arg) {
  * Creates a CostEvaluator instance.
  *
  * This class stores various penalty terms, and can be used to determine the
- * costs of certain constraint violations.
+ * costs of certain constraint violations. Cost evaluators are immutable, and
+ * can be shared between threads.
  *
  * Parameters
  * ----------
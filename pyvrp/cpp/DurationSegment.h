@@ -108,6 +108,9 @@ public:
     // Construct from attributes of the given client.
     DurationSegment(size_t idx, ProblemData::Client const &client);
 
+    // Construct from the given location's packed data columns.
+    inline DurationSegment(ProblemData const &data, size_t idx);
+
     // Construct from raw data.
     inline DurationSegment(size_t idxFirst,
                            size_t idxLast,
@@ -194,6 +197,17 @@ Duration DurationSegment::timeWarp(Duration const maxDuration) const
     // clang-format on
 }
 
+DurationSegment::DurationSegment(ProblemData const &data, size_t idx)
+    : idxFirst_(idx),
+      idxLast_(idx),
+      duration_(data.serviceDuration()[idx]),
+      timeWarp_(0),
+      twEarly_(data.twEarly()[idx]),
+      twLate_(data.twLate()[idx]),
+      releaseTime_(data.releaseTime()[idx])
+{
+}
+
 DurationSegment::DurationSegment(size_t idxFirst,
                                  size_t idxLast,
                                  Duration duration,
@@ -0,0 +1,114 @@
+#ifndef PYVRP_HUGEPAGEALLOCATOR_H
+#define PYVRP_HUGEPAGEALLOCATOR_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace pyvrp
+{
+/**
+ * Allocator that backs large allocations with transparent huge pages, where
+ * the platform supports those. Random lookups into large arrays, such as the
+ * distance and duration matrices, otherwise mostly miss the TLB with regular
+ * 4 KB pages.
+ * <br />
+ * Allocations of at least HUGE_PAGE_SIZE bytes are aligned to a huge page
+ * boundary, and advised to be backed by huge pages. When the kernel does not
+ * support huge pages, regular pages are used instead. Smaller allocations, and
+ * all allocations on platforms other than Linux, use the default allocator.
+ * Huge pages can be disabled by setting the ``PYVRP_NO_HUGE_PAGES``
+ * environment variable to a value other than ``0``.
+ */
+template <typename T> class HugePageAllocator
+{
+    // On Linux, large allocations use posix_memalign and free rather than the
+    // default allocator. Whether an allocation is large depends only on its
+    // size, so deallocate() knows which of the two to use.
+    [[nodiscard]] static bool isLarge(size_t n);
+
+public:
+    using value_type = T;
+
+    static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    HugePageAllocator() = default;
+
+    template <typename U>
+    HugePageAllocator([[maybe_unused]] HugePageAllocator<U> const &other)
+    {
+    }
+
+    /**
+     * Returns whether huge pages are currently enabled.
+     */
+    [[nodiscard]] static bool enabled();
+
+    [[nodiscard]] T *allocate(size_t n);
+
+    void deallocate(T *ptr, size_t n);
+};
+
+template <typename T, typename U>
+bool operator==(HugePageAllocator<T> const &, HugePageAllocator<U> const &)
+{
+    return true;  // stateless, so any instance can free another's memory
+}
+
+template <typename T> bool HugePageAllocator<T>::isLarge(size_t n)
+{
+#if defined(__linux__)
+    return n >= HUGE_PAGE_SIZE / sizeof(T);
+#else
+    return false;
+#endif
+}
+
+template <typename T> bool HugePageAllocator<T>::enabled()
+{
+    auto const *value = std::getenv("PYVRP_NO_HUGE_PAGES");
+    return value == nullptr || *value == '\0' || std::strcmp(value, "0") == 0;
+}
+
+template <typename T> T *HugePageAllocator<T>::allocate(size_t n)
+{
+    if (!isLarge(n))
+        return std::allocator<T>().allocate(n);
+
+#if defined(__linux__)
+    auto const numBytes = n * sizeof(T);
+
+    void *ptr = nullptr;
+    if (posix_memalign(&ptr, HUGE_PAGE_SIZE, numBytes) != 0)
+        throw std::bad_alloc();
+
+    // Failure is not a problem: it means the kernel does not support huge
+    // pages, and then regular pages are used. When huge pages are disabled,
+    // we explicitly opt out, since the kernel may otherwise still use huge
+    // pages for this aligned allocation.
+#if defined(MADV_HUGEPAGE) && defined(MADV_NOHUGEPAGE)
+    madvise(ptr, numBytes, enabled() ? MADV_HUGEPAGE : MADV_NOHUGEPAGE);
+#endif
+
+    return static_cast<T *>(ptr);
+#else
+    return nullptr;  // unreachable: isLarge() is always false here
+#endif
+}
+
+template <typename T> void HugePageAllocator<T>::deallocate(T *ptr, size_t n)
+{
+    if (isLarge(n))
+        std::free(ptr);
+    else
+        std::allocator<T>().deallocate(ptr, n);
+}
+}  // namespace pyvrp
+
+#endif  // PYVRP_HUGEPAGEALLOCATOR_H
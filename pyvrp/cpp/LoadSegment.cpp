@@ -1,12 +1,7 @@
 #include "LoadSegment.h"
 
-using pyvrp::Load;
 using pyvrp::LoadSegment;
 
-Load LoadSegment::delivery() const { return delivery_; }
-
-Load LoadSegment::pickup() const { return pickup_; }
-
 LoadSegment::LoadSegment(ProblemData::Client const &client)
     : delivery_(client.delivery),
       pickup_(client.pickup),
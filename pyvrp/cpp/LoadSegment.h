@@ -37,12 +37,12 @@ public:
      * Returns the delivery amount, that is, the total amount of load delivered
      * to clients on this segment.
      */
-    [[nodiscard]] Load delivery() const;
+    [[nodiscard]] inline Load delivery() const;
 
     /**
      * Returns the amount picked up from clients on this segment.
      */
-    [[nodiscard]] Load pickup() const;
+    [[nodiscard]] inline Load pickup() const;
 
     /**
      * Returns the maximum load encountered on this segment.
@@ -52,6 +52,9 @@ public:
     // Construct from attributes of the given client.
     LoadSegment(ProblemData::Client const &client);
 
+    // Construct from the given location's packed data columns.
+    inline LoadSegment(ProblemData const &data, size_t idx);
+
     // Construct from raw data.
     inline LoadSegment(Load delivery, Load pickup, Load load);
 
@@ -82,8 +85,19 @@ LoadSegment LoadSegment::merge(LoadSegment const &first,
         return merge(res, args...);
 }
 
+Load LoadSegment::delivery() const { return delivery_; }
+
+Load LoadSegment::pickup() const { return pickup_; }
+
 Load LoadSegment::load() const { return load_; }
 
+LoadSegment::LoadSegment(ProblemData const &data, size_t idx)
+    : delivery_(data.delivery()[idx]),
+      pickup_(data.pickup()[idx]),
+      load_(std::max(delivery_, pickup_))
+{
+}
+
 LoadSegment::LoadSegment(Load delivery, Load pickup, Load load)
     : delivery_(delivery), pickup_(pickup), load_(load)
 {
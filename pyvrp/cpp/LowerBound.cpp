@@ -0,0 +1,274 @@
+#include "LowerBound.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+using pyvrp::Cost;
+using pyvrp::Duration;
+using pyvrp::Load;
+using pyvrp::ProblemData;
+
+namespace
+{
+// Returns the minimum number of vehicles needed to carry the given total load,
+// assuming the load can be divided freely over the vehicles.
+size_t minNumVehicles(std::vector<Load> const &capacities, Load totalLoad)
+{
+    size_t numVehicles = 0;
+    Load carried = 0;
+    while (carried < totalLoad && numVehicles != capacities.size())
+        carried += capacities[numVehicles++];
+
+    return numVehicles;
+}
+
+// Computes the cheapest cost of each arc over all vehicle types. The duration
+// of an arc includes the service duration at its origin.
+class ArcCosts
+{
+    ProblemData const &data;
+    std::vector<std::tuple<size_t, Cost, Cost>> types;
+    std::vector<Duration> service;
+
+public:
+    explicit ArcCosts(ProblemData const &data)
+        : data(data), service(data.numLocations(), 0)
+    {
+        // Vehicle types with the same profile and unit costs have the same
+        // arc costs, so we only need to consider each such combination once.
+        for (auto const &vehType : data.vehicleTypes())
+            types.emplace_back(vehType.profile,
+                               vehType.unitDistanceCost,
+                               vehType.unitDurationCost);
+
+        std::sort(types.begin(), types.end());
+        types.erase(std::unique(types.begin(), types.end()), types.end());
+
+        for (auto idx = data.numDepots(); idx != data.numLocations(); ++idx)
+        {
+            ProblemData::Client const &client = data.location(idx);
+            service[idx] = client.serviceDuration;
+        }
+    }
+
+    Cost operator()(size_t from, size_t to) const
+    {
+        auto cost = std::numeric_limits<Cost>::max();
+        for (auto const &[profile, unitDistCost, unitDurCost] : types)
+        {
+            auto const dist = data.distanceMatrix(profile)(from, to);
+            auto typeCost = unitDistCost * static_cast<Cost>(dist);
+#ifndef PYVRP_NO_TIME_WINDOWS
+            auto const dur = data.durationMatrix(profile)(from, to);
+            typeCost += unitDurCost * static_cast<Cost>(dur + service[from]);
+#endif
+            cost = std::min(cost, typeCost);
+        }
+
+        return cost;
+    }
+};
+
+// Bound based on the cheapest incoming and outgoing arcs of each location.
+// Each visited client is left and entered exactly once, and each used vehicle
+// leaves and enters a depot once. Unvisited optional clients cost their prize.
+Cost degreeBound(ProblemData const &data,
+                 ArcCosts const &arcCost,
+                 size_t numVehicles,
+                 Cost fixedCost)
+{
+    auto const numLocs = data.numLocations();
+    auto const numDepots = data.numDepots();
+    auto const maxCost = std::numeric_limits<Cost>::max();
+
+    std::vector<Cost> minOut(numLocs, maxCost);
+    std::vector<Cost> minIn(numLocs, maxCost);
+
+    for (size_t from = 0; from != numLocs; ++from)
+        for (size_t to = 0; to != numLocs; ++to)
+            if (from != to && (from >= numDepots || to >= numDepots))
+            {
+                auto const cost = arcCost(from, to);
+                minOut[from] = std::min(minOut[from], cost);
+                minIn[to] = std::min(minIn[to], cost);
+            }
+
+    Cost outBound = 0;
+    Cost inBound = 0;
+    for (auto idx = numDepots; idx != numLocs; ++idx)
+    {
+        ProblemData::Client const &client = data.location(idx);
+        if (client.required)
+        {
+            outBound += minOut[idx];
+            inBound += minIn[idx];
+        }
+        else
+        {
+            outBound += std::min(minOut[idx], client.prize);
+            inBound += std::min(minIn[idx], client.prize);
+        }
+    }
+
+    if (numVehicles == 0)
+        return std::max(outBound, inBound);
+
+    auto const depotOut = *std::min_element(minOut.begin(),
+                                            minOut.begin() + numDepots);
+    auto const depotIn = *std::min_element(minIn.begin(),
+                                           minIn.begin() + numDepots);
+
+    auto const vehicles = static_cast<Cost>(numVehicles);
+    outBound += vehicles * (fixedCost + depotOut);
+    inBound += vehicles * (fixedCost + depotIn);
+    return std::max(outBound, inBound);
+}
+
+// Bound based on spanning forests, for instances where all clients must be
+// visited. Removing the depots from a solution with R routes leaves R paths
+// over the clients: a spanning forest with R trees, which costs at least as
+// much as the cheapest such forest. Each route further connects to a depot
+// twice. Arc directions are ignored by using the cheaper direction of each
+// arc.
+Cost forestBound(ProblemData const &data,
+                 ArcCosts const &arcCost,
+                 size_t minVehicles,
+                 size_t maxVehicles,
+                 Cost fixedCost)
+{
+    auto const numDepots = data.numDepots();
+    auto const numClients = data.numClients();
+    auto const edgeCost = [&](size_t first, size_t second)
+    { return std::min(arcCost(first, second), arcCost(second, first)); };
+
+    // Prim's algorithm for a minimum spanning tree over the clients. Removing
+    // the R - 1 most expensive edges from this tree results in the cheapest
+    // spanning forest with R trees.
+    std::vector<Cost> treeEdges;
+    std::vector<Cost> minEdge(numClients, std::numeric_limits<Cost>::max());
+    std::vector<bool> inTree(numClients, false);
+
+    for (size_t next = 0; next != numClients;)
+    {
+        auto const curr = next;
+        inTree[curr] = true;
+
+        if (curr != 0)  // first client does not connect to the tree
+            treeEdges.push_back(minEdge[curr]);
+
+        for (size_t other = 0; other != numClients; ++other)
+            if (!inTree[other])
+            {
+                auto const cost = edgeCost(curr + numDepots, other + numDepots);
+                minEdge[other] = std::min(minEdge[other], cost);
+            }
+
+        next = numClients;
+        for (size_t other = 0; other != numClients; ++other)
+            if (!inTree[other]
+                && (next == numClients || minEdge[other] < minEdge[next]))
+                next = other;
+    }
+
+    // The depot edges of each client, which each client can use at most twice
+    // (when it is the only client on its route).
+    std::vector<Cost> depotEdges;
+    for (size_t client = numDepots; client != data.numLocations(); ++client)
+    {
+        auto cost = std::numeric_limits<Cost>::max();
+        for (size_t depot = 0; depot != numDepots; ++depot)
+            cost = std::min(cost, edgeCost(depot, client));
+
+        depotEdges.insert(depotEdges.end(), 2, cost);
+    }
+
+    std::sort(treeEdges.begin(), treeEdges.end(), std::greater<>());
+    std::sort(depotEdges.begin(), depotEdges.end());
+
+    Cost forest = 0;
+    for (auto const cost : treeEdges)
+        forest += cost;
+
+    Cost depots = 0;
+    for (size_t idx = 0; idx != 2 * minVehicles; ++idx)
+        depots += depotEdges[idx];
+
+    for (size_t idx = 0; idx + 1 < minVehicles; ++idx)
+        forest -= treeEdges[idx];
+
+    // Using more vehicles makes the forest cheaper, but adds depot edges and
+    // fixed costs, so we take the minimum over all feasible numbers of routes.
+    auto bound = std::numeric_limits<Cost>::max();
+    for (auto numRoutes = minVehicles; numRoutes <= maxVehicles; ++numRoutes)
+    {
+        auto const fixed = static_cast<Cost>(numRoutes) * fixedCost;
+        bound = std::min(bound, forest + depots + fixed);
+
+        if (numRoutes == maxVehicles)
+            break;
+
+        forest -= treeEdges[numRoutes - 1];
+        depots += depotEdges[2 * numRoutes] + depotEdges[2 * numRoutes + 1];
+    }
+
+    return bound;
+}
+}  // namespace
+
+Cost pyvrp::lowerBound(ProblemData const &data)
+{
+    if (data.numClients() == 0)
+        return 0;
+
+    // Every vehicle that is used incurs a fixed cost. Required clients need
+    // at least one vehicle, and enough to carry their total delivery and
+    // pickup demand.
+    std::vector<Load> capacities;
+    auto fixedCost = std::numeric_limits<Cost>::max();
+    for (auto const &vehType : data.vehicleTypes())
+    {
+        capacities.insert(
+            capacities.end(), vehType.numAvailable, vehType.capacity);
+        fixedCost = std::min(fixedCost, vehType.fixedCost);
+    }
+
+    std::sort(capacities.begin(), capacities.end(), std::greater<>());
+
+    Load delivery = 0;
+    Load pickup = 0;
+    bool anyRequired = false;
+    bool allRequired = true;
+    for (auto const &client : data.clients())
+    {
+        if (client.required)
+        {
+            delivery += client.delivery;
+            pickup += client.pickup;
+        }
+
+        anyRequired |= client.required;
+        allRequired &= client.required;
+    }
+
+    size_t numVehicles = anyRequired ? 1 : 0;
+    numVehicles = std::max(numVehicles, minNumVehicles(capacities, delivery));
+    numVehicles = std::max(numVehicles, minNumVehicles(capacities, pickup));
+
+    ArcCosts const arcCost(data);
+    auto const bound = degreeBound(data, arcCost, numVehicles, fixedCost);
+    if (!allRequired)
+        return bound;
+
+    // Each route visits at least one client, so there cannot be more routes
+    // than clients.
+    auto const maxVehicles = std::min(data.numVehicles(), data.numClients());
+    if (numVehicles > maxVehicles)
+        return bound;
+
+    auto const forest
+        = forestBound(data, arcCost, numVehicles, maxVehicles, fixedCost);
+    return std::max(bound, forest);
+}
@@ -0,0 +1,49 @@
+#ifndef PYVRP_LOWERBOUND_H
+#define PYVRP_LOWERBOUND_H
+
+#include "Measure.h"
+#include "ProblemData.h"
+
+namespace pyvrp
+{
+/**
+ * Computes a lower bound on the cost of any feasible solution to the given
+ * instance. This bound can be used to assess the quality of a solution, or to
+ * stop the search once a solution is provably close to optimal.
+ *
+ * The returned value is the larger of two bounds. Both use the minimum number
+ * of vehicles needed, which follows from the total delivery and pickup demand
+ * of the required clients. Each used vehicle incurs a fixed cost.
+ *
+ * The first is a degree bound. Each visited client is left and entered
+ * exactly once, so the cheapest outgoing (incoming) arc of each client bounds
+ * the cost of the arcs leaving (entering) clients. Each used vehicle further
+ * travels from and back to a depot. Optional clients contribute at most their
+ * prize, since they may also be left unvisited.
+ *
+ * The second is a spanning forest bound, which is only used when all clients
+ * are required. Removing the depots from a solution with :math:`R` routes
+ * leaves a spanning forest of :math:`R` trees over the clients, which costs at
+ * least as much as the cheapest such forest. Each route further connects to a
+ * depot twice. This bound is minimised over all feasible numbers of routes.
+ *
+ * Arc costs are the cheapest distance and duration costs over all vehicle
+ * types. The duration of an arc includes the service duration at its origin.
+ * The spanning forest bound ignores arc directions by using the cheaper
+ * direction of each arc.
+ *
+ * Parameters
+ * ----------
+ * data
+ *     Data instance.
+ *
+ * Returns
+ * -------
+ * int
+ *     A lower bound on the cost of a feasible solution, as computed by
+ *     :meth:`~pyvrp._pyvrp.CostEvaluator.cost`.
+ */
+Cost lowerBound(ProblemData const &data);
+}  // namespace pyvrp
+
+#endif  // PYVRP_LOWERBOUND_H
@@ -1,19 +1,28 @@
 #ifndef PYVRP_MATRIX_H
 #define PYVRP_MATRIX_H
 
+#include "HugePageAllocator.h"
+
 #include <algorithm>
 #include <cassert>
 #include <sstream>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace pyvrp
 {
 template <typename T> class Matrix
 {
-    size_t cols_ = 0;           // The number of columns of the matrix
-    size_t rows_ = 0;           // The number of rows of the matrix
-    std::vector<T> data_ = {};  // Data vector
+public:
+    // Large matrices are backed by huge pages, since random lookups into
+    // those otherwise mostly miss the TLB.
+    using Storage = std::vector<T, HugePageAllocator<T>>;
+
+private:
+    size_t cols_ = 0;  // The number of columns of the matrix
+    size_t rows_ = 0;  // The number of rows of the matrix
+    Storage data_ = {};
 
 public:
     Matrix() = default;  // default is an empty matrix
@@ -26,7 +35,17 @@ public:
      */
     explicit Matrix(size_t nRows, size_t nCols);
 
-    explicit Matrix(std::vector<T> data, size_t nRows, size_t nCols);
+    /**
+     * Creates a matrix of size nRows * nCols from the given row-major data.
+     * The data is copied into huge page-backed storage.
+     */
+    explicit Matrix(std::vector<T> const &data, size_t nRows, size_t nCols);
+
+    /**
+     * Creates a matrix of size nRows * nCols from the given row-major data,
+     * which is moved into the matrix without copying.
+     */
+    explicit Matrix(Storage &&data, size_t nRows, size_t nCols);
 
     [[nodiscard]] decltype(auto) operator()(size_t row, size_t col);
     [[nodiscard]] decltype(auto) operator()(size_t row, size_t col) const;
@@ -56,7 +75,14 @@ Matrix<T>::Matrix(size_t nRows, size_t nCols)
 }
 
 template <typename T>
-Matrix<T>::Matrix(std::vector<T> data, size_t nRows, size_t nCols)
+Matrix<T>::Matrix(std::vector<T> const &data, size_t nRows, size_t nCols)
+    : cols_(nCols), rows_(nRows), data_(data.begin(), data.end())
+{
+    assert(cols_ * rows_ == data_.size());
+}
+
+template <typename T>
+Matrix<T>::Matrix(Storage &&data, size_t nRows, size_t nCols)
     : cols_(nCols), rows_(nRows), data_(std::move(data))
 {
     assert(cols_ * rows_ == data_.size());
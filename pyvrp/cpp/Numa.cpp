@@ -0,0 +1,194 @@
+#include "Numa.h"
+
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace
+{
+// Parses a list of the form "0-3,8,10-11", as used by Linux's sysfs.
+std::vector<size_t> parseList(std::string const &list)
+{
+    std::vector<size_t> items;
+    std::istringstream in(list);
+    std::string range;
+
+    while (std::getline(in, range, ','))
+    {
+        if (range.empty())
+            continue;
+
+        auto const dash = range.find('-');
+        auto const first = std::stoul(range.substr(0, dash));
+        auto const last = dash == std::string::npos
+                              ? first
+                              : std::stoul(range.substr(dash + 1));
+
+        for (auto item = first; item <= last; ++item)
+            items.push_back(item);
+    }
+
+    return items;
+}
+
+std::string readLine(std::string const &path)
+{
+    std::ifstream in(path);
+    std::string line;
+    std::getline(in, line);
+    return line;
+}
+
+// Returns the system's identifiers of the online NUMA nodes. These need not
+// be consecutive, so the functions below index into this list.
+std::vector<size_t> onlineNodes()
+{
+#if defined(__linux__)
+    try
+    {
+        auto nodes = parseList(readLine("/sys/devices/system/node/online"));
+        if (!nodes.empty())
+            return nodes;
+    }
+    catch (std::exception const &)  // malformed file; treat as single node
+    {
+    }
+#endif
+
+    return {0};
+}
+
+// Returns all CPUs of the given node, including those that the calling thread
+// is not allowed to run on.
+std::vector<size_t> allNodeCpus([[maybe_unused]] size_t node)
+{
+#if defined(__linux__)
+    try
+    {
+        auto const id = std::to_string(onlineNodes()[node]);
+        auto const path = "/sys/devices/system/node/node" + id + "/cpulist";
+        return parseList(readLine(path));
+    }
+    catch (std::exception const &)
+    {
+    }
+#endif
+
+    return {};
+}
+
+void checkNode(size_t node)
+{
+    if (node >= pyvrp::numNumaNodes())
+        throw std::out_of_range("NUMA node does not exist.");
+}
+}  // namespace
+
+size_t pyvrp::numNumaNodes() { return onlineNodes().size(); }
+
+std::vector<size_t> pyvrp::numaNodeCpus(size_t node)
+{
+    checkNode(node);
+    auto cpus = allNodeCpus(node);
+
+#if defined(__linux__)
+    // Only retain the CPUs we may run on. Containers and task sets commonly
+    // restrict those to a subset of the machine's CPUs.
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0)
+    {
+        auto const notAllowed = [&](size_t cpu)
+        { return cpu >= CPU_SETSIZE || !CPU_ISSET(cpu, &allowed); };
+
+        std::erase_if(cpus, notAllowed);
+    }
+#endif
+
+    return cpus;
+}
+
+size_t pyvrp::currentNumaNode()
+{
+#if defined(__linux__)
+    auto const result = sched_getcpu();
+    if (result < 0)
+        return 0;
+
+    auto const cpu = static_cast<size_t>(result);
+
+    for (size_t node = 0; node != numNumaNodes(); ++node)
+    {
+        auto const cpus = allNodeCpus(node);
+        if (std::find(cpus.begin(), cpus.end(), cpu) != cpus.end())
+            return node;
+    }
+#endif
+
+    return 0;
+}
+
+void pyvrp::bindToNumaNode(size_t node)
+{
+    checkNode(node);
+    if (numNumaNodes() == 1)
+        return;
+
+    auto const cpus = numaNodeCpus(node);
+    if (cpus.empty())
+        return;
+
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (auto const cpu : cpus)
+        CPU_SET(cpu, &set);
+
+    // Failure leaves the thread's affinity as it was, which only costs us
+    // performance.
+    sched_setaffinity(0, sizeof(set), &set);
+#endif
+}
+
+std::unique_ptr<pyvrp::ProblemData>
+pyvrp::replicateOnNumaNode(ProblemData const &data, size_t node)
+{
+    checkNode(node);
+    if (numNumaNodes() == 1)
+        return std::make_unique<ProblemData>(data);
+
+    // The copy is made by a new thread that is bound to the given node. That
+    // thread is the first to touch the copy's memory, so the operating system
+    // places that memory on the node.
+    std::unique_ptr<ProblemData> replica;
+    std::exception_ptr error;
+
+    std::thread thread(
+        [&]()
+        {
+            try
+            {
+                bindToNumaNode(node);
+                replica = std::make_unique<ProblemData>(data);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+        });
+
+    thread.join();
+
+    if (error)
+        std::rethrow_exception(error);
+
+    return replica;
+}
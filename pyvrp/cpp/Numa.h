@@ -0,0 +1,63 @@
+#ifndef PYVRP_NUMA_H
+#define PYVRP_NUMA_H
+
+#include "ProblemData.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace pyvrp
+{
+/**
+ * Returns the number of NUMA nodes of this machine. This is one on machines
+ * that have a single NUMA node, and on platforms where the NUMA topology is
+ * not available.
+ */
+size_t numNumaNodes();
+
+/**
+ * Returns the CPUs of the given NUMA node that the calling thread is allowed
+ * to run on. Returns an empty list when the topology is not available.
+ *
+ * Raises
+ * ------
+ * IndexError
+ *     When the given NUMA node does not exist.
+ */
+std::vector<size_t> numaNodeCpus(size_t node);
+
+/**
+ * Returns the NUMA node the calling thread is currently running on.
+ */
+size_t currentNumaNode();
+
+/**
+ * Binds the calling thread to the CPUs of the given NUMA node. Memory that
+ * the thread touches first is then placed on that node. This does nothing on
+ * machines with a single NUMA node, or where the calling thread may not run
+ * on any of the node's CPUs.
+ *
+ * Raises
+ * ------
+ * IndexError
+ *     When the given NUMA node does not exist.
+ */
+void bindToNumaNode(size_t node);
+
+/**
+ * Returns a copy of the given data instance that is placed in the memory of
+ * the given NUMA node. The copy is made by a thread bound to that node, so
+ * the matrices and client data are placed there when first touched. On
+ * machines with a single NUMA node, this is a regular copy.
+ *
+ * Raises
+ * ------
+ * IndexError
+ *     When the given NUMA node does not exist.
+ */
+std::unique_ptr<ProblemData> replicateOnNumaNode(ProblemData const &data,
+                                                 size_t node);
+}  // namespace pyvrp
+
+#endif  // PYVRP_NUMA_H
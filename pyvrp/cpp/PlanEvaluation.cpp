@@ -0,0 +1,300 @@
+#include "PlanEvaluation.h"
+#include "DurationSegment.h"
+#include "LoadSegment.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+using pyvrp::Cost;
+using pyvrp::Distance;
+using pyvrp::Duration;
+using pyvrp::Load;
+using pyvrp::PlanEvaluation;
+
+namespace
+{
+// Number of plans a thread takes at once from the shared plan counter.
+size_t constexpr PLANS_PER_TASK = 16;
+
+void checkOffsets(std::span<size_t const> offsets,
+                  size_t size,
+                  char const *name)
+{
+    if (offsets.empty() || offsets.front() != 0 || offsets.back() != size)
+    {
+        std::ostringstream msg;
+        msg << name << " must start at 0 and end at " << size << '.';
+        throw std::invalid_argument(msg.str());
+    }
+
+    if (!std::is_sorted(offsets.begin(), offsets.end()))
+    {
+        std::ostringstream msg;
+        msg << name << " must be non-decreasing.";
+        throw std::invalid_argument(msg.str());
+    }
+}
+
+// Evaluates a single plan, and writes its route and plan statistics to the
+// given evaluation. The visit counts are used as scratch space, and reset to
+// zero before returning.
+void evaluatePlan(pyvrp::ProblemData const &data,
+                  pyvrp::CostEvaluator const &costEvaluator,
+                  std::span<size_t const> visits,
+                  std::span<size_t const> routeOffsets,
+                  std::span<size_t const> vehicleTypes,
+                  size_t firstRoute,
+                  size_t lastRoute,
+                  size_t plan,
+                  Cost allPrizes,
+                  std::vector<size_t> &visitCounts,
+                  std::vector<size_t> &usedVehicles,
+                  PlanEvaluation &eval)
+{
+    Distance distance = 0;
+    Duration duration = 0;
+    Cost distanceCost = 0;
+    Cost durationCost = 0;
+    Cost fixedCost = 0;
+    Cost prizes = 0;
+    Load excessLoad = 0;
+    Duration timeWarp = 0;
+    Distance excessDistance = 0;
+    bool feasible = true;
+
+    for (auto route = firstRoute; route != lastRoute; ++route)
+    {
+        auto const routeVisits = visits.subspan(
+            routeOffsets[route], routeOffsets[route + 1] - routeOffsets[route]);
+
+        if (routeVisits.empty())
+        {
+            eval.routeFeasible[route] = true;
+            continue;
+        }
+
+        auto const vehicleType = vehicleTypes[route];
+        auto const &vehType = data.vehicleType(vehicleType);
+        usedVehicles[vehicleType]++;
+
+        // This follows the route evaluation in Solution::Route's constructor,
+        // but does not store the visits or any of the other route statistics.
+        pyvrp::ProblemData::Depot const &depot = data.location(vehType.depot);
+        pyvrp::DurationSegment depotDS(
+            vehType.depot,
+            vehType.depot,
+            0,
+            0,
+            std::max(depot.twEarly, vehType.twEarly),
+            std::min(depot.twLate, vehType.twLate),
+            0);
+
+        auto ds = depotDS;
+        auto ls = pyvrp::LoadSegment(0, 0, 0);
+        Distance routeDist = 0;
+        size_t prev = vehType.depot;
+
+        auto const &distances = data.distanceMatrix(vehType.profile);
+        auto const &durations = data.durationMatrix(vehType.profile);
+
+        for (auto const client : routeVisits)
+        {
+            pyvrp::ProblemData::Client const &clientData
+                = data.location(client);
+
+            routeDist += distances(prev, client);
+            prizes += clientData.prize;
+            visitCounts[client]++;
+
+            pyvrp::DurationSegment const clientDS(client, clientData);
+            ds = pyvrp::DurationSegment::merge(durations, ds, clientDS);
+            ls = pyvrp::LoadSegment::merge(ls, pyvrp::LoadSegment(clientData));
+
+            prev = client;
+        }
+
+        routeDist += distances(prev, vehType.depot);
+        ds = pyvrp::DurationSegment::merge(durations, ds, depotDS);
+
+        auto const routeDur = ds.duration();
+        auto const routeExcessLoad
+            = std::max<Load>(ls.load() - vehType.capacity, 0);
+        auto const routeTimeWarp = ds.timeWarp(vehType.maxDuration);
+        auto const routeExcessDist
+            = std::max<Distance>(routeDist - vehType.maxDistance, 0);
+        auto const routeDistCost
+            = vehType.unitDistanceCost * static_cast<Cost>(routeDist);
+        auto const routeDurCost
+            = vehType.unitDurationCost * static_cast<Cost>(routeDur);
+        auto const routeFeasible = routeExcessLoad == 0 && routeTimeWarp == 0
+                                   && routeExcessDist == 0;
+
+        eval.routeDistance[route] = routeDist;
+        eval.routeDuration[route] = routeDur;
+        eval.routeExcessLoad[route] = routeExcessLoad;
+        eval.routeTimeWarp[route] = routeTimeWarp;
+        eval.routeExcessDistance[route] = routeExcessDist;
+        eval.routeCost[route]
+            = vehType.fixedCost + routeDistCost + routeDurCost;
+        eval.routeFeasible[route] = routeFeasible;
+
+        distance += routeDist;
+        duration += routeDur;
+        distanceCost += routeDistCost;
+        durationCost += routeDurCost;
+        fixedCost += vehType.fixedCost;
+        excessLoad += routeExcessLoad;
+        timeWarp += routeTimeWarp;
+        excessDistance += routeExcessDist;
+        feasible &= routeFeasible;
+    }
+
+    // The plan must visit each required client exactly once, and each client
+    // group must be satisfied. Afterwards, we reset the visit counts.
+    for (auto idx = data.numDepots(); idx != data.numLocations(); ++idx)
+    {
+        pyvrp::ProblemData::Client const &client = data.location(idx);
+        feasible &= visitCounts[idx] <= 1;
+        feasible &= !client.required || visitCounts[idx] == 1;
+    }
+
+    for (auto const &group : data.groups())
+    {
+        auto const inPlan = [&](auto client) { return visitCounts[client]; };
+        auto const numIn = std::count_if(group.begin(), group.end(), inPlan);
+        feasible &= group.required ? numIn == 1 : numIn <= 1;
+    }
+
+    for (auto route = firstRoute; route != lastRoute; ++route)
+        for (auto idx = routeOffsets[route]; idx != routeOffsets[route + 1];
+             ++idx)
+            visitCounts[visits[idx]] = 0;
+
+    for (size_t vehType = 0; vehType != data.numVehicleTypes(); ++vehType)
+    {
+        auto const numAvailable = data.vehicleType(vehType).numAvailable;
+        feasible &= usedVehicles[vehType] <= numAvailable;
+        usedVehicles[vehType] = 0;
+    }
+
+    auto const uncollected = allPrizes - prizes;
+    auto const penalised
+        = distanceCost + durationCost + fixedCost + uncollected
+          + costEvaluator.loadPenalty(excessLoad, 0)
+          + costEvaluator.twPenalty(timeWarp)
+          + costEvaluator.distPenalty(excessDistance, 0);
+
+    eval.distance[plan] = distance;
+    eval.duration[plan] = duration;
+    eval.distanceCost[plan] = distanceCost;
+    eval.durationCost[plan] = durationCost;
+    eval.fixedVehicleCost[plan] = fixedCost;
+    eval.uncollectedPrizes[plan] = uncollected;
+    eval.excessLoad[plan] = excessLoad;
+    eval.timeWarp[plan] = timeWarp;
+    eval.excessDistance[plan] = excessDistance;
+    eval.penalisedCost[plan] = penalised;
+    eval.cost[plan] = feasible ? penalised : std::numeric_limits<Cost>::max();
+    eval.feasible[plan] = feasible;
+}
+}  // namespace
+
+PlanEvaluation::PlanEvaluation(size_t numRoutes, size_t numPlans)
+    : routeDistance(numRoutes),
+      routeDuration(numRoutes),
+      routeExcessLoad(numRoutes),
+      routeTimeWarp(numRoutes),
+      routeExcessDistance(numRoutes),
+      routeCost(numRoutes),
+      routeFeasible(numRoutes),
+      distance(numPlans),
+      duration(numPlans),
+      distanceCost(numPlans),
+      durationCost(numPlans),
+      fixedVehicleCost(numPlans),
+      uncollectedPrizes(numPlans),
+      excessLoad(numPlans),
+      timeWarp(numPlans),
+      excessDistance(numPlans),
+      penalisedCost(numPlans),
+      cost(numPlans),
+      feasible(numPlans)
+{
+}
+
+PlanEvaluation pyvrp::evaluatePlans(ProblemData const &data,
+                                    CostEvaluator const &costEvaluator,
+                                    std::span<size_t const> visits,
+                                    std::span<size_t const> routeOffsets,
+                                    std::span<size_t const> vehicleTypes,
+                                    std::span<size_t const> planOffsets,
+                                    size_t numThreads)
+{
+    if (numThreads == 0)
+        throw std::invalid_argument("num_threads must be positive.");
+
+    checkOffsets(routeOffsets, visits.size(), "route_offsets");
+    checkOffsets(planOffsets, vehicleTypes.size(), "plan_offsets");
+
+    if (routeOffsets.size() != vehicleTypes.size() + 1)
+        throw std::invalid_argument("Expected a vehicle type for each route.");
+
+    for (auto const client : visits)
+        if (client < data.numDepots() || client >= data.numLocations())
+            throw std::out_of_range("Visit is not a client.");
+
+    for (auto const vehType : vehicleTypes)
+        if (vehType >= data.numVehicleTypes())
+            throw std::out_of_range("Vehicle type does not exist.");
+
+    Cost allPrizes = 0;
+    for (auto const &client : data.clients())
+        allPrizes += client.prize;
+
+    auto const numPlans = planOffsets.size() - 1;
+    PlanEvaluation eval(vehicleTypes.size(), numPlans);
+
+    // Threads take the next few plans to evaluate from a shared counter. Each
+    // plan writes to its own entries of the evaluation, so no further
+    // synchronisation is needed.
+    std::atomic<size_t> next = 0;
+    auto const work = [&]()
+    {
+        std::vector<size_t> visitCounts(data.numLocations(), 0);
+        std::vector<size_t> usedVehicles(data.numVehicleTypes(), 0);
+
+        for (auto first = next.fetch_add(PLANS_PER_TASK); first < numPlans;
+             first = next.fetch_add(PLANS_PER_TASK))
+            for (auto plan = first;
+                 plan != std::min(first + PLANS_PER_TASK, numPlans);
+                 ++plan)
+                evaluatePlan(data,
+                             costEvaluator,
+                             visits,
+                             routeOffsets,
+                             vehicleTypes,
+                             planOffsets[plan],
+                             planOffsets[plan + 1],
+                             plan,
+                             allPrizes,
+                             visitCounts,
+                             usedVehicles,
+                             eval);
+    };
+
+    auto const numTasks = (numPlans + PLANS_PER_TASK - 1) / PLANS_PER_TASK;
+    std::vector<std::thread> threads;
+    for (size_t idx = 1; idx < std::min(numThreads, numTasks); ++idx)
+        threads.emplace_back(work);
+
+    work();
+
+    for (auto &thread : threads)
+        thread.join();
+
+    return eval;
+}
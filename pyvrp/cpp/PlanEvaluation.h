@@ -0,0 +1,102 @@
+#ifndef PYVRP_PLANEVALUATION_H
+#define PYVRP_PLANEVALUATION_H
+
+#include "CostEvaluator.h"
+#include "Measure.h"
+#include "ProblemData.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace pyvrp
+{
+/**
+ * Statistics of a batch of plans, as computed by :func:`evaluate_plans`. Route
+ * statistics are stored per route, in the order the routes were given. Plan
+ * statistics are stored per plan.
+ */
+struct PlanEvaluation
+{
+    // Route statistics.
+    std::vector<Distance> routeDistance;
+    std::vector<Duration> routeDuration;
+    std::vector<Load> routeExcessLoad;
+    std::vector<Duration> routeTimeWarp;
+    std::vector<Distance> routeExcessDistance;
+    std::vector<Cost> routeCost;  // fixed, distance, and duration costs
+    std::vector<uint8_t> routeFeasible;
+
+    // Plan statistics.
+    std::vector<Distance> distance;
+    std::vector<Duration> duration;
+    std::vector<Cost> distanceCost;
+    std::vector<Cost> durationCost;
+    std::vector<Cost> fixedVehicleCost;
+    std::vector<Cost> uncollectedPrizes;
+    std::vector<Load> excessLoad;
+    std::vector<Duration> timeWarp;
+    std::vector<Distance> excessDistance;
+    std::vector<Cost> penalisedCost;
+    std::vector<Cost> cost;
+    std::vector<uint8_t> feasible;
+
+    PlanEvaluation(size_t numRoutes, size_t numPlans);
+};
+
+/**
+ * Evaluates a batch of plans, without constructing a
+ * :class:`~pyvrp._pyvrp.Solution` for each plan. The plans are given as flat
+ * arrays: ``visits`` concatenates the visits of all routes, route ``r``
+ * visits ``visits[route_offsets[r]:route_offsets[r + 1]]`` using vehicle type
+ * ``vehicle_types[r]``, and plan ``p`` consists of the routes
+ * ``plan_offsets[p]`` up to ``plan_offsets[p + 1]``. Empty routes are allowed,
+ * and are not counted as used vehicles.
+ *
+ * The plans are evaluated in parallel. A plan that visits a client more than
+ * once, or uses more vehicles of a type than are available, is not rejected,
+ * but is marked as infeasible.
+ *
+ * Parameters
+ * ----------
+ * data
+ *     Data instance.
+ * cost_evaluator
+ *     Cost evaluator used to compute the penalised and objective costs.
+ * visits
+ *     Client visits of all routes.
+ * route_offsets
+ *     Offsets into ``visits`` of each route, and the total number of visits.
+ * vehicle_types
+ *     Vehicle type of each route.
+ * plan_offsets
+ *     Offsets into the routes of each plan, and the total number of routes.
+ * num_threads
+ *     Number of threads to use. Default 1.
+ *
+ * Returns
+ * -------
+ * PlanEvaluation
+ *     Statistics of each route, and of each plan. Plan costs follow
+ *     :meth:`~pyvrp._pyvrp.CostEvaluator.penalised_cost` and
+ *     :meth:`~pyvrp._pyvrp.CostEvaluator.cost`.
+ *
+ * Raises
+ * ------
+ * ValueError
+ *     When the offsets are not non-decreasing, do not start at zero, or do not
+ *     end at the number of visits or routes. Also raised when
+ *     ``num_threads`` is zero.
+ * IndexError
+ *     When a visit is not a client, or a vehicle type does not exist.
+ */
+PlanEvaluation evaluatePlans(ProblemData const &data,
+                             CostEvaluator const &costEvaluator,
+                             std::span<size_t const> visits,
+                             std::span<size_t const> routeOffsets,
+                             std::span<size_t const> vehicleTypes,
+                             std::span<size_t const> planOffsets,
+                             size_t numThreads = 1);
+}  // namespace pyvrp
+
+#endif  // PYVRP_PLANEVALUATION_H
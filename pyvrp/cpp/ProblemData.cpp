@@ -473,5 +473,48 @@ ProblemData::ProblemData(std::vector<Client> clients,
         centroid_.second += static_cast<double>(client.y) / numClients();
     }
 
+    auto const numLocs = numLocations();
+    x_.reserve(numLocs);
+    y_.reserve(numLocs);
+    delivery_.reserve(numLocs);
+    pickup_.reserve(numLocs);
+    serviceDuration_.reserve(numLocs);
+    twEarly_.reserve(numLocs);
+    twLate_.reserve(numLocs);
+    releaseTime_.reserve(numLocs);
+    prize_.reserve(numLocs);
+    required_.reserve(numLocs);
+    groupMembership_.reserve(numLocs);
+
+    for (auto const &depot : depots_)
+    {
+        x_.push_back(depot.x);
+        y_.push_back(depot.y);
+        delivery_.push_back(0);
+        pickup_.push_back(0);
+        serviceDuration_.push_back(0);
+        twEarly_.push_back(depot.twEarly);
+        twLate_.push_back(depot.twLate);
+        releaseTime_.push_back(0);
+        prize_.push_back(0);
+        required_.push_back(false);
+        groupMembership_.push_back(-1);
+    }
+
+    for (auto const &client : clients_)
+    {
+        x_.push_back(client.x);
+        y_.push_back(client.y);
+        delivery_.push_back(client.delivery);
+        pickup_.push_back(client.pickup);
+        serviceDuration_.push_back(client.serviceDuration);
+        twEarly_.push_back(client.twEarly);
+        twLate_.push_back(client.twLate);
+        releaseTime_.push_back(client.releaseTime);
+        prize_.push_back(client.prize);
+        required_.push_back(client.required);
+        groupMembership_.push_back(client.group ? *client.group : -1);
+    }
+
     validate();
 }
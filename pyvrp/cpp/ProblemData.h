@@ -23,7 +23,8 @@ namespace pyvrp
  * )
  *
  * Creates a problem data instance. This instance contains all information
- * needed to solve the vehicle routing problem.
+ * needed to solve the vehicle routing problem. Problem data instances are
+ * immutable, and can be shared between threads.
  *
  * .. note::
  *
@@ -457,6 +458,25 @@ private:
 
     size_t const numVehicles_;
 
+    // Column-wise copies of the location data, indexed by location. Depot
+    // entries are padded with neutral values: no load, service duration,
+    // release time or prize, not required, and no group (-1). The required
+    // column uses char rather than bool since std::vector<bool> is not stored
+    // contiguously. The search's hot paths read from these packed columns
+    // rather than from the (much larger) Client objects, so that each lookup
+    // touches only the fields it needs.
+    std::vector<Coordinate> x_;
+    std::vector<Coordinate> y_;
+    std::vector<Load> delivery_;
+    std::vector<Load> pickup_;
+    std::vector<Duration> serviceDuration_;
+    std::vector<Duration> twEarly_;
+    std::vector<Duration> twLate_;
+    std::vector<Duration> releaseTime_;
+    std::vector<Cost> prize_;
+    std::vector<char> required_;
+    std::vector<Value> groupMembership_;
+
 public:
     /**
      * Returns location data for the location at the given index. This can
@@ -512,6 +532,70 @@ public:
      */
     [[nodiscard]] std::vector<Matrix<Duration>> const &durationMatrices() const;
 
+    /**
+     * Horizontal coordinates of all locations, indexed by location.
+     *
+     * .. note::
+     *
+     *    This and the other column methods below return a read-only view of
+     *    the underlying data. Nothing is copied, but the resulting array
+     *    cannot be modified in any way! Depots are part of these columns,
+     *    with zero delivery, pickup, service duration, release time and
+     *    prize, and they are not required.
+     */
+    [[nodiscard]] inline std::vector<Coordinate> const &x() const;
+
+    /**
+     * Vertical coordinates of all locations, indexed by location.
+     */
+    [[nodiscard]] inline std::vector<Coordinate> const &y() const;
+
+    /**
+     * Delivery amounts of all locations, indexed by location.
+     */
+    [[nodiscard]] inline std::vector<Load> const &delivery() const;
+
+    /**
+     * Pickup amounts of all locations, indexed by location.
+     */
+    [[nodiscard]] inline std::vector<Load> const &pickup() const;
+
+    /**
+     * Service durations of all locations, indexed by location.
+     */
+    [[nodiscard]] inline std::vector<Duration> const &serviceDuration() const;
+
+    /**
+     * Start of the time windows of all locations, indexed by location.
+     */
+    [[nodiscard]] inline std::vector<Duration> const &twEarly() const;
+
+    /**
+     * End of the time windows of all locations, indexed by location.
+     */
+    [[nodiscard]] inline std::vector<Duration> const &twLate() const;
+
+    /**
+     * Release times of all locations, indexed by location.
+     */
+    [[nodiscard]] inline std::vector<Duration> const &releaseTime() const;
+
+    /**
+     * Prizes of all locations, indexed by location.
+     */
+    [[nodiscard]] inline std::vector<Cost> const &prize() const;
+
+    /**
+     * Whether each location is a required client, indexed by location.
+     */
+    [[nodiscard]] inline std::vector<char> const &required() const;
+
+    /**
+     * Client group each location is a member of, indexed by location. This
+     * is ``-1`` for locations that are not part of any group.
+     */
+    [[nodiscard]] inline std::vector<Value> const &groupMembership() const;
+
     /**
      * Center point of all client locations (excluding depots).
      */
@@ -662,6 +746,37 @@ ProblemData::Location ProblemData::location(size_t idx) const
                : Location{.client = &clients_[idx - depots_.size()]};
 }
 
+std::vector<Coordinate> const &ProblemData::x() const { return x_; }
+
+std::vector<Coordinate> const &ProblemData::y() const { return y_; }
+
+std::vector<Load> const &ProblemData::delivery() const { return delivery_; }
+
+std::vector<Load> const &ProblemData::pickup() const { return pickup_; }
+
+std::vector<Duration> const &ProblemData::serviceDuration() const
+{
+    return serviceDuration_;
+}
+
+std::vector<Duration> const &ProblemData::twEarly() const { return twEarly_; }
+
+std::vector<Duration> const &ProblemData::twLate() const { return twLate_; }
+
+std::vector<Duration> const &ProblemData::releaseTime() const
+{
+    return releaseTime_;
+}
+
+std::vector<Cost> const &ProblemData::prize() const { return prize_; }
+
+std::vector<char> const &ProblemData::required() const { return required_; }
+
+std::vector<Value> const &ProblemData::groupMembership() const
+{
+    return groupMembership_;
+}
+
 Matrix<Distance> const &ProblemData::distanceMatrix(size_t profile) const
 {
     assert(profile < dists_.size());
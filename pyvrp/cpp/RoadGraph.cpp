@@ -0,0 +1,626 @@
+#include "RoadGraph.h"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+using pyvrp::Coordinate;
+using pyvrp::Distance;
+using pyvrp::Duration;
+using pyvrp::Matrix;
+using pyvrp::RoadGraph;
+using pyvrp::Value;
+
+namespace
+{
+// Distance and duration of locations that cannot be reached from one another.
+// This is the same as pyvrp.constants.MAX_VALUE.
+Value constexpr UNREACHABLE = Value(1) << 52;
+
+// Maximum number of nodes settled in a single witness search. Limiting the
+// witness searches may add a few unnecessary shortcuts, but greatly speeds up
+// the construction of the hierarchy.
+size_t constexpr MAX_WITNESS_SETTLED = 500;
+
+// Path weights are compared on duration first, and distance second.
+using Weight = std::pair<Value, Value>;
+
+Weight add(Weight const &lhs, Weight const &rhs)
+{
+    return {lhs.first + rhs.first, lhs.second + rhs.second};
+}
+
+Weight const INF = {std::numeric_limits<Value>::max(),
+                    std::numeric_limits<Value>::max()};
+
+struct Edge
+{
+    size_t to;
+    Weight weight;
+};
+
+// Builds a contraction hierarchy by contracting the nodes one by one, in order
+// of the edge difference plus the number of contracted neighbours. When a node
+// is contracted, shortcuts are added between its remaining neighbours if there
+// is no witness path that avoids the contracted node.
+class Contractor
+{
+    size_t const numNodes;
+    std::vector<std::vector<Edge>> out;
+    std::vector<std::vector<Edge>> in;
+    std::vector<size_t> numContractedNbrs;
+
+    // Witness search state. The distances are reset after each search.
+    std::vector<Weight> dist;
+    std::vector<size_t> touched;
+
+    // Adds the edge from -> to, or improves the existing edge.
+    void addEdge(size_t from, size_t to, Weight weight);
+
+    // Removes all edges between the given node and its neighbours.
+    void removeNode(size_t node);
+
+    // Dijkstra search from source, that avoids the given node and stops when
+    // it exceeds the given weight or has settled enough nodes.
+    void witnessSearch(size_t source, size_t avoid, Weight maxWeight);
+
+    // Determines the shortcuts needed to contract the given node. These are
+    // added to the graph if addShortcuts is set, and otherwise only counted.
+    size_t shortcuts(size_t node, bool addShortcuts);
+
+    long priority(size_t node);
+
+public:
+    Contractor(size_t numNodes, std::vector<std::pair<size_t, Edge>> arcs);
+
+    // Contracts all nodes. When a node is contracted, calls the given function
+    // with the node and its remaining outgoing and incoming edges. These go to
+    // nodes that are contracted later, and thus have a higher rank.
+    void contract(std::function<void(size_t,
+                                     std::vector<Edge> const &,
+                                     std::vector<Edge> const &)> const &onNode);
+};
+
+Contractor::Contractor(size_t numNodes,
+                       std::vector<std::pair<size_t, Edge>> arcs)
+    : numNodes(numNodes),
+      out(numNodes),
+      in(numNodes),
+      numContractedNbrs(numNodes, 0),
+      dist(numNodes, INF)
+{
+    for (auto const &[from, edge] : arcs)
+        if (from != edge.to)  // self-loops are never part of shortest paths
+            addEdge(from, edge.to, edge.weight);
+}
+
+void Contractor::addEdge(size_t from, size_t to, Weight weight)
+{
+    for (auto &edge : out[from])
+        if (edge.to == to)
+        {
+            if (weight < edge.weight)
+            {
+                edge.weight = weight;
+                for (auto &rev : in[to])
+                    if (rev.to == from)
+                        rev.weight = weight;
+            }
+
+            return;
+        }
+
+    out[from].push_back({to, weight});
+    in[to].push_back({from, weight});
+}
+
+void Contractor::removeNode(size_t node)
+{
+    auto const erase = [node](std::vector<Edge> &edges)
+    {
+        auto const isNode = [node](auto const &edge)
+        { return edge.to == node; };
+        edges.erase(std::remove_if(edges.begin(), edges.end(), isNode),
+                    edges.end());
+    };
+
+    for (auto const &edge : out[node])
+        erase(in[edge.to]);
+
+    for (auto const &edge : in[node])
+        erase(out[edge.to]);
+
+    out[node].clear();
+    in[node].clear();
+}
+
+void Contractor::witnessSearch(size_t source, size_t avoid, Weight maxWeight)
+{
+    for (auto const node : touched)
+        dist[node] = INF;
+    touched.clear();
+
+    using Item = std::pair<Weight, size_t>;
+    std::priority_queue<Item, std::vector<Item>, std::greater<>> queue;
+
+    dist[source] = {0, 0};
+    touched.push_back(source);
+    queue.push({dist[source], source});
+
+    size_t numSettled = 0;
+    while (!queue.empty() && numSettled < MAX_WITNESS_SETTLED)
+    {
+        auto const [weight, node] = queue.top();
+        queue.pop();
+
+        if (weight > dist[node])  // stale queue entry
+            continue;
+
+        if (weight > maxWeight)
+            break;
+
+        numSettled++;
+        for (auto const &edge : out[node])
+        {
+            auto const newWeight = add(weight, edge.weight);
+            if (edge.to == avoid || newWeight >= dist[edge.to])
+                continue;
+
+            if (dist[edge.to] == INF)
+                touched.push_back(edge.to);
+
+            dist[edge.to] = newWeight;
+            queue.push({newWeight, edge.to});
+        }
+    }
+}
+
+size_t Contractor::shortcuts(size_t node, bool addShortcuts)
+{
+    std::vector<std::pair<size_t, Edge>> needed;
+
+    for (auto const &inEdge : in[node])
+    {
+        Weight maxWeight = {0, 0};
+        for (auto const &outEdge : out[node])
+            maxWeight
+                = std::max(maxWeight, add(inEdge.weight, outEdge.weight));
+
+        witnessSearch(inEdge.to, node, maxWeight);
+
+        for (auto const &outEdge : out[node])
+        {
+            if (outEdge.to == inEdge.to)
+                continue;
+
+            // A shortcut is needed when no witness path is at least as short
+            // as the path through the contracted node.
+            auto const viaWeight = add(inEdge.weight, outEdge.weight);
+            if (dist[outEdge.to] > viaWeight)
+                needed.push_back({inEdge.to, Edge{outEdge.to, viaWeight}});
+        }
+    }
+
+    if (addShortcuts)
+        for (auto const &[from, edge] : needed)
+            addEdge(from, edge.to, edge.weight);
+
+    return needed.size();
+}
+
+long Contractor::priority(size_t node)
+{
+    long const numShortcuts = shortcuts(node, false);
+    long const numEdges = in[node].size() + out[node].size();
+    return numShortcuts - numEdges + numContractedNbrs[node];
+}
+
+void Contractor::contract(
+    std::function<void(size_t,
+                       std::vector<Edge> const &,
+                       std::vector<Edge> const &)> const &onNode)
+{
+    using Item = std::pair<long, size_t>;
+    std::priority_queue<Item, std::vector<Item>, std::greater<>> queue;
+
+    for (size_t node = 0; node != numNodes; ++node)
+        queue.push({priority(node), node});
+
+    while (!queue.empty())
+    {
+        auto const node = queue.top().second;
+        queue.pop();
+
+        // Lazy updates: priorities may be outdated since other nodes were
+        // contracted. If the node is no longer the most attractive node to
+        // contract, we re-insert it with its updated priority.
+        auto const prio = priority(node);
+        if (!queue.empty() && prio > queue.top().first)
+        {
+            queue.push({prio, node});
+            continue;
+        }
+
+        onNode(node, out[node], in[node]);
+        shortcuts(node, true);
+
+        for (auto const &edge : out[node])
+            numContractedNbrs[edge.to]++;
+
+        for (auto const &edge : in[node])
+            numContractedNbrs[edge.to]++;
+
+        removeNode(node);
+    }
+}
+
+void parseError(size_t lineNo, std::string const &msg)
+{
+    std::ostringstream err;
+    err << "Line " << lineNo << " of graph file: " << msg;
+    throw std::invalid_argument(err.str());
+}
+}  // namespace
+
+RoadGraph::RoadGraph(std::string const &path, size_t maxCachedRows)
+    : maxCachedRows(maxCachedRows)
+{
+    if (maxCachedRows == 0)
+        throw std::invalid_argument("max_cached_rows must be positive.");
+
+    std::ifstream file(path);
+    if (!file)
+        throw std::invalid_argument("Could not open graph file " + path + ".");
+
+    size_t numNodes = 0;
+    size_t numArcs = 0;
+    bool hasHeader = false;
+    std::vector<std::pair<size_t, Edge>> arcs;
+    std::vector<bool> hasCoords;
+
+    std::string line;
+    for (size_t lineNo = 1; std::getline(file, line); ++lineNo)
+    {
+        std::istringstream stream(line);
+        char type;
+        if (!(stream >> type) || type == '#')  // empty or comment line
+            continue;
+
+        if (!hasHeader && type != 'p')
+            parseError(lineNo, "expected 'p <num_nodes> <num_arcs>' first.");
+
+        if (type == 'p')
+        {
+            if (hasHeader || !(stream >> numNodes >> numArcs))
+                parseError(lineNo, "invalid 'p' line.");
+
+            hasHeader = true;
+            hasCoords.resize(numNodes, false);
+            coords.resize(numNodes);
+            arcs.reserve(numArcs);
+        }
+        else if (type == 'v')
+        {
+            size_t node;
+            Value x, y;
+            if (!(stream >> node >> x >> y) || node >= numNodes)
+                parseError(lineNo, "invalid 'v' line.");
+
+            coords[node] = {x, y};
+            hasCoords[node] = true;
+        }
+        else if (type == 'a')
+        {
+            size_t from, to;
+            Value distance, duration;
+            if (!(stream >> from >> to >> distance >> duration)
+                || from >= numNodes || to >= numNodes || distance < 0
+                || duration < 0)
+                parseError(lineNo, "invalid 'a' line.");
+
+            arcs.push_back({from, {to, {duration, distance}}});
+        }
+        else
+            parseError(lineNo, "unknown line type.");
+    }
+
+    if (!hasHeader)
+        throw std::invalid_argument("Graph file is empty.");
+
+    if (arcs.size() != numArcs)
+        throw std::invalid_argument("Number of arcs does not match header.");
+
+    // Coordinates are all or nothing: if some nodes do not have coordinates,
+    // we cannot reliably find nearest nodes.
+    if (std::find(hasCoords.begin(), hasCoords.end(), false) != hasCoords.end())
+        coords.clear();
+
+    // Contract the graph, and collect the upward arcs of each node. These are
+    // stored in compressed sparse row format once the contraction is done.
+    std::vector<std::vector<Arc>> fwd(numNodes);
+    std::vector<std::vector<Arc>> bwd(numNodes);
+
+    Contractor contractor(numNodes, std::move(arcs));
+    contractor.contract(
+        [&](size_t node, auto const &outEdges, auto const &inEdges)
+        {
+            for (auto const &edge : outEdges)
+                fwd[node].push_back(
+                    {edge.to, edge.weight.first, edge.weight.second});
+
+            for (auto const &edge : inEdges)
+                bwd[node].push_back(
+                    {edge.to, edge.weight.first, edge.weight.second});
+        });
+
+    auto const toCsr = [&](auto const &graph, auto &offsets, auto &flatArcs)
+    {
+        offsets.reserve(numNodes + 1);
+        offsets.push_back(0);
+        for (auto const &nodeArcs : graph)
+        {
+            flatArcs.insert(flatArcs.end(), nodeArcs.begin(), nodeArcs.end());
+            offsets.push_back(flatArcs.size());
+        }
+    };
+
+    toCsr(fwd, fwdOffsets, fwdArcs);
+    toCsr(bwd, bwdOffsets, bwdArcs);
+
+    buckets.resize(numNodes);
+}
+
+std::vector<RoadGraph::Label> RoadGraph::upwardSearch(size_t node,
+                                                      bool forward) const
+{
+    auto const &offsets = forward ? fwdOffsets : bwdOffsets;
+    auto const &arcs = forward ? fwdArcs : bwdArcs;
+
+    // Upward search spaces are small, so we index the labels by node in a
+    // hash map rather than in arrays over all nodes. That also keeps this
+    // method safe to call from multiple threads.
+    std::vector<Label> labels;
+    std::unordered_map<size_t, Weight> dist;
+
+    using Item = std::pair<Weight, size_t>;
+    std::priority_queue<Item, std::vector<Item>, std::greater<>> queue;
+
+    dist[node] = {0, 0};
+    queue.push({{0, 0}, node});
+
+    while (!queue.empty())
+    {
+        auto const [weight, curr] = queue.top();
+        queue.pop();
+
+        if (weight > dist[curr])  // stale queue entry
+            continue;
+
+        labels.push_back({curr, weight.first, weight.second});
+        for (auto idx = offsets[curr]; idx != offsets[curr + 1]; ++idx)
+        {
+            auto const &arc = arcs[idx];
+            auto const newWeight
+                = add(weight, {arc.duration.get(), arc.distance.get()});
+
+            auto const [it, inserted] = dist.try_emplace(arc.head, newWeight);
+            if (inserted || newWeight < it->second)
+            {
+                it->second = newWeight;
+                queue.push({newWeight, arc.head});
+            }
+        }
+    }
+
+    return labels;
+}
+
+RoadGraph::Row RoadGraph::computeRow(size_t location) const
+{
+    std::vector<Weight> best(locations.size(), INF);
+    for (auto const &label : upwardSearch(locations[location], true))
+        for (auto const &entry : buckets[label.node])
+        {
+            Weight const weight
+                = {label.duration.get() + entry.duration.get(),
+                   label.distance.get() + entry.distance.get()};
+
+            best[entry.location] = std::min(best[entry.location], weight);
+        }
+
+    Row row;
+    row.distances.reserve(best.size());
+    row.durations.reserve(best.size());
+
+    for (auto const &[duration, distance] : best)
+    {
+        auto const reachable = duration != INF.first;
+        row.distances.push_back(reachable ? distance : UNREACHABLE);
+        row.durations.push_back(reachable ? duration : UNREACHABLE);
+    }
+
+    return row;
+}
+
+std::vector<RoadGraph::Label> RoadGraph::addToBuckets(size_t location)
+{
+    auto labels = upwardSearch(locations[location], false);
+    for (auto const &label : labels)
+        buckets[label.node].push_back(
+            {location, label.duration, label.distance});
+
+    return labels;
+}
+
+void RoadGraph::checkNode(size_t node) const
+{
+    if (node >= numNodes())
+        throw std::out_of_range("Node not in graph.");
+}
+
+void RoadGraph::checkLocation(size_t location) const
+{
+    if (location >= locations.size())
+        throw std::out_of_range("Location not registered.");
+}
+
+size_t RoadGraph::numNodes() const { return buckets.size(); }
+
+size_t RoadGraph::numLocations() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return locations.size();
+}
+
+size_t RoadGraph::numCachedRows() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return cache.size();
+}
+
+void RoadGraph::setLocations(std::vector<size_t> const &nodes)
+{
+    for (auto const node : nodes)
+        checkNode(node);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (auto &bucket : buckets)
+        bucket.clear();
+
+    lru.clear();
+    cache.clear();
+
+    locations = nodes;
+    for (size_t location = 0; location != locations.size(); ++location)
+        addToBuckets(location);
+}
+
+size_t RoadGraph::addLocation(size_t node)
+{
+    checkNode(node);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto const location = locations.size();
+    locations.push_back(node);
+
+    std::unordered_map<size_t, Weight> toNew;
+    for (auto const &label : addToBuckets(location))
+        toNew[label.node] = {label.duration.get(), label.distance.get()};
+
+    // Extend the cached rows with the distance and duration to the new
+    // location. These meet the backward search space of the new location in
+    // the forward search space of the cached row's location.
+    for (auto &[cached, item] : cache)
+    {
+        Weight best = INF;
+        for (auto const &label : upwardSearch(locations[cached], true))
+            if (auto const it = toNew.find(label.node); it != toNew.end())
+            {
+                Weight const weight = {label.duration.get(),
+                                       label.distance.get()};
+                best = std::min(best, add(weight, it->second));
+            }
+
+        auto const reachable = best != INF;
+        auto &row = item.second;
+        row.distances.push_back(reachable ? best.second : UNREACHABLE);
+        row.durations.push_back(reachable ? best.first : UNREACHABLE);
+    }
+
+    return location;
+}
+
+size_t RoadGraph::nearestNode(Coordinate x, Coordinate y) const
+{
+    if (coords.empty())
+        throw std::invalid_argument("Graph has no node coordinates.");
+
+    auto const sqDist = [&](auto const &coord)
+    {
+        auto const diffX = static_cast<double>((coord.first - x).get());
+        auto const diffY = static_cast<double>((coord.second - y).get());
+        return diffX * diffX + diffY * diffY;
+    };
+
+    auto const nearest = std::min_element(
+        coords.begin(),
+        coords.end(),
+        [&](auto const &a, auto const &b) { return sqDist(a) < sqDist(b); });
+
+    return std::distance(coords.begin(), nearest);
+}
+
+RoadGraph::Row RoadGraph::row(size_t location)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    checkLocation(location);
+
+    if (auto it = cache.find(location); it != cache.end())
+    {
+        lru.splice(lru.begin(), lru, it->second.first);  // move to front
+        return it->second.second;
+    }
+
+    if (cache.size() == maxCachedRows)
+    {
+        cache.erase(lru.back());
+        lru.pop_back();
+    }
+
+    lru.push_front(location);
+    auto const [it, _] = cache.emplace(
+        location, std::make_pair(lru.begin(), computeRow(location)));
+
+    return it->second.second;
+}
+
+std::pair<Matrix<Distance>, Matrix<Duration>>
+RoadGraph::matrices(size_t numThreads) const
+{
+    if (numThreads == 0)
+        throw std::invalid_argument("num_threads must be positive.");
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto const size = locations.size();
+    Matrix<Distance> distMat(size, size);
+    Matrix<Duration> durMat(size, size);
+
+    // Threads take the next row to compute from a shared counter. Each row is
+    // written to its own part of the matrices, so no further synchronisation
+    // is needed.
+    std::atomic<size_t> next = 0;
+    auto const work = [&]()
+    {
+        for (auto loc = next++; loc < size; loc = next++)
+        {
+            auto const it = cache.find(loc);
+            auto const row
+                = it != cache.end() ? it->second.second : computeRow(loc);
+
+            std::copy(row.distances.begin(),
+                      row.distances.end(),
+                      distMat.data() + loc * size);
+            std::copy(row.durations.begin(),
+                      row.durations.end(),
+                      durMat.data() + loc * size);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t idx = 1; idx < std::min(numThreads, size); ++idx)
+        threads.emplace_back(work);
+
+    work();
+
+    for (auto &thread : threads)
+        thread.join();
+
+    return {std::move(distMat), std::move(durMat)};
+}
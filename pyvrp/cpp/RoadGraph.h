@@ -0,0 +1,254 @@
+#ifndef PYVRP_ROADGRAPH_H
+#define PYVRP_ROADGRAPH_H
+
+#include "Matrix.h"
+#include "Measure.h"
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace pyvrp
+{
+/**
+ * RoadGraph(path: str, max_cached_rows: int = 1_000)
+ *
+ * Creates a RoadGraph instance.
+ *
+ * The road graph is read from a local graph file, and preprocessed into a
+ * contraction hierarchy. That hierarchy is used to compute rows of the
+ * distance and duration matrices between a set of locations on demand. The
+ * most recently used rows are kept in a cache, so memory use is proportional
+ * to the rows that are actually used, rather than to the full matrices.
+ *
+ * The graph file is a plain text file. Each line starts with a single
+ * character that indicates its type:
+ *
+ * * ``p <num_nodes> <num_arcs>`` gives the size of the graph. This must be the
+ *   first line of the file.
+ * * ``v <node> <x> <y>`` gives the coordinates of a node. These are optional,
+ *   and only used to find the node nearest to a given point.
+ * * ``a <from> <to> <distance> <duration>`` gives a directed arc.
+ * * ``#`` starts a comment line.
+ *
+ * Nodes are zero-indexed, and arc distances and durations must be
+ * non-negative integers. Shortest paths minimise duration first, and
+ * distance second. Locations that cannot be reached from one another get
+ * distance and duration ``MAX_VALUE``, as defined in :mod:`pyvrp.constants`.
+ *
+ * A road graph may be shared between threads: its methods can be called
+ * concurrently.
+ *
+ * Parameters
+ * ----------
+ * path
+ *     Path to the graph file.
+ * max_cached_rows
+ *     Maximum number of rows to keep in the row cache. When the cache is full,
+ *     the least recently used row is removed. Default 1000.
+ *
+ * Raises
+ * ------
+ * ValueError
+ *     When the graph file cannot be read or is malformed, or when
+ *     ``max_cached_rows`` is zero.
+ */
+class RoadGraph
+{
+public:
+    struct Row
+    {
+        std::vector<Distance> distances;
+        std::vector<Duration> durations;
+    };
+
+private:
+    struct Arc
+    {
+        size_t head;
+        Duration duration;
+        Distance distance;
+    };
+
+    struct Label  // shortest path (duration, distance) to or from a node
+    {
+        size_t node;
+        Duration duration;
+        Distance distance;
+    };
+
+    struct BucketEntry
+    {
+        size_t location;
+        Duration duration;
+        Distance distance;
+    };
+
+    // Upward graphs of the contraction hierarchy, in compressed sparse row
+    // format. The forward graph contains the arcs from each node to higher
+    // ranked nodes. The backward graph contains, for each node, the reversed
+    // arcs from higher ranked nodes.
+    std::vector<size_t> fwdOffsets;
+    std::vector<Arc> fwdArcs;
+    std::vector<size_t> bwdOffsets;
+    std::vector<Arc> bwdArcs;
+
+    std::vector<std::pair<Coordinate, Coordinate>> coords;
+
+    // Graph node of each location, and for each graph node the backward
+    // search labels of the locations whose search space contains it.
+    std::vector<size_t> locations;
+    std::vector<std::vector<BucketEntry>> buckets;
+
+    size_t const maxCachedRows;
+    std::list<size_t> lru;  // cached locations, most recently used first
+    std::unordered_map<size_t, std::pair<std::list<size_t>::iterator, Row>>
+        cache;
+
+    // Guards the locations, buckets, and row cache, which are modified when
+    // locations are added or rows are requested.
+    mutable std::mutex mutex;
+
+    // Runs a Dijkstra search from the given node in the (forward or backward)
+    // upward graph, and returns the labels of all nodes it settles.
+    [[nodiscard]] std::vector<Label> upwardSearch(size_t node,
+                                                  bool forward) const;
+
+    // Computes the row of the given location by scanning the buckets of the
+    // nodes in its forward search space.
+    [[nodiscard]] Row computeRow(size_t location) const;
+
+    // Adds the backward search labels of the given location to the buckets,
+    // and returns those labels.
+    std::vector<Label> addToBuckets(size_t location);
+
+    void checkNode(size_t node) const;
+    void checkLocation(size_t location) const;
+
+public:
+    RoadGraph(std::string const &path, size_t maxCachedRows = 1'000);
+
+    /**
+     * Returns the number of nodes in the road graph.
+     */
+    [[nodiscard]] size_t numNodes() const;
+
+    /**
+     * Returns the number of locations currently registered.
+     */
+    [[nodiscard]] size_t numLocations() const;
+
+    /**
+     * Returns the number of rows currently in the row cache.
+     */
+    [[nodiscard]] size_t numCachedRows() const;
+
+    /**
+     * Sets the locations to compute rows for. Location ``i`` is mapped to the
+     * given graph node ``nodes[i]``. This clears the row cache.
+     *
+     * Parameters
+     * ----------
+     * nodes
+     *     Graph node of each location, typically in the same order as the
+     *     locations in the :class:`~pyvrp._pyvrp.ProblemData` instance.
+     *
+     * Raises
+     * ------
+     * IndexError
+     *     When one of the nodes is not in the graph.
+     */
+    void setLocations(std::vector<size_t> const &nodes);
+
+    /**
+     * Adds a new location at the given graph node. Rows that are in the cache
+     * are extended with the distance and duration to the new location, so
+     * they remain valid. Other rows are not recomputed.
+     *
+     * Parameters
+     * ----------
+     * node
+     *     Graph node of the new location.
+     *
+     * Returns
+     * -------
+     * int
+     *     Index of the new location.
+     *
+     * Raises
+     * ------
+     * IndexError
+     *     When the node is not in the graph.
+     */
+    size_t addLocation(size_t node);
+
+    /**
+     * Returns the graph node nearest to the given coordinates, in Euclidean
+     * distance.
+     *
+     * Parameters
+     * ----------
+     * x
+     *     Horizontal coordinate.
+     * y
+     *     Vertical coordinate.
+     *
+     * Raises
+     * ------
+     * ValueError
+     *     When the graph file did not provide node coordinates.
+     */
+    [[nodiscard]] size_t nearestNode(Coordinate x, Coordinate y) const;
+
+    /**
+     * Returns the distances and durations from the given location to all
+     * locations. The row is taken from the cache if possible, and otherwise
+     * computed and added to the cache.
+     *
+     * Parameters
+     * ----------
+     * location
+     *     Location whose row to return.
+     *
+     * Returns
+     * -------
+     * tuple
+     *     Tuple of distance and duration rows.
+     *
+     * Raises
+     * ------
+     * IndexError
+     *     When the location is not registered.
+     */
+    [[nodiscard]] Row row(size_t location);
+
+    /**
+     * Computes the full distance and duration matrices between all locations.
+     * Rows are computed in parallel, using a many-to-many search. Rows in the
+     * cache are reused, but newly computed rows are not added to it.
+     *
+     * Parameters
+     * ----------
+     * num_threads
+     *     Number of threads to use. Default 1.
+     *
+     * Returns
+     * -------
+     * tuple
+     *     Tuple of distance and duration matrices, that can be passed to
+     *     :class:`~pyvrp._pyvrp.ProblemData`.
+     *
+     * Raises
+     * ------
+     * ValueError
+     *     When ``num_threads`` is zero.
+     */
+    [[nodiscard]] std::pair<Matrix<Distance>, Matrix<Duration>>
+    matrices(size_t numThreads = 1) const;
+};
+}  // namespace pyvrp
+
+#endif  // PYVRP_ROADGRAPH_H
@@ -0,0 +1,355 @@
+#include "RoutePool.h"
+#include "DynamicBitset.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+using pyvrp::Cost;
+using pyvrp::RoutePool;
+using pyvrp::Solution;
+
+namespace
+{
+// Hashes the given vehicle type and visits, by combining the hashes of their
+// values as in boost::hash_combine.
+size_t hashRoute(size_t vehicleType,
+                 std::vector<size_t> const &visits)
+{
+    std::hash<size_t> hasher;
+    size_t hash = hasher(vehicleType);
+
+    for (auto const client : visits)
+        hash ^= hasher(client) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+    return hash;
+}
+}  // namespace
+
+RoutePool::RoutePool(ProblemData const &data, size_t maxSize)
+    : data(data), maxSize(maxSize)
+{
+    if (maxSize == 0)
+        throw std::invalid_argument("max_size must be positive.");
+}
+
+bool RoutePool::contains(size_t hash,
+                         size_t vehicleType,
+                         std::vector<size_t> const &visits) const
+{
+    auto const [first, last] = index.equal_range(hash);
+    for (auto it = first; it != last; ++it)
+    {
+        auto const &column = columns[it->second];
+        if (column.vehicleType == vehicleType && column.visits == visits)
+            return true;
+    }
+
+    return false;
+}
+
+void RoutePool::removeWorst()
+{
+    auto const costPerClient = [](Column const &column)
+    { return column.cost.get() / static_cast<double>(column.visits.size()); };
+
+    auto const worst = std::max_element(
+        columns.begin(),
+        columns.end(),
+        [&](auto const &col1, auto const &col2)
+        { return costPerClient(col1) < costPerClient(col2); });
+
+    // Remove the worst column by moving the last column into its place. That
+    // requires updating the index of the moved column as well.
+    size_t const worstIdx = std::distance(columns.begin(), worst);
+    size_t const lastIdx = columns.size() - 1;
+
+    auto const eraseIndex = [&](size_t hash, size_t idx)
+    {
+        auto const [first, last] = index.equal_range(hash);
+        for (auto it = first; it != last; ++it)
+            if (it->second == idx)
+            {
+                index.erase(it);
+                return;
+            }
+    };
+
+    eraseIndex(columns[worstIdx].hash, worstIdx);
+
+    if (worstIdx != lastIdx)
+    {
+        eraseIndex(columns[lastIdx].hash, lastIdx);
+        columns[worstIdx] = std::move(columns[lastIdx]);
+        index.emplace(columns[worstIdx].hash, worstIdx);
+    }
+
+    columns.pop_back();
+}
+
+void RoutePool::add(Solution const &solution)
+{
+    for (auto const &route : solution.routes())
+    {
+        if (!route.isFeasible())  // the set-partitioning problem only selects
+            continue;             // feasible routes.
+
+        auto const vehicleType = route.vehicleType();
+        auto const hash = hashRoute(vehicleType, route.visits());
+        if (contains(hash, vehicleType, route.visits()))
+            continue;
+
+        if (columns.size() == maxSize)
+            removeWorst();
+
+        auto const &vehType = data.vehicleType(vehicleType);
+        auto const cost = route.distanceCost() + route.durationCost()
+                          + vehType.fixedCost - route.prizes();
+
+        index.emplace(hash, columns.size());
+        columns.push_back({route.visits(), vehicleType, cost, hash});
+    }
+}
+
+void RoutePool::clear()
+{
+    columns.clear();
+    index.clear();
+}
+
+size_t RoutePool::size() const { return columns.size(); }
+
+std::optional<Solution> RoutePool::select(Solution const &incumbent,
+                                          double timeLimit) const
+{
+    if (columns.empty())
+        return std::nullopt;
+
+    // The objective of a solution consisting of feasible routes is the sum of
+    // the route costs, plus the total value of all uncollected prizes. Since
+    // the column costs subtract the collected prizes, we compare solutions on
+    // the column costs alone.
+    auto bestCost = std::numeric_limits<Cost>::max();
+    if (incumbent.isFeasible())
+    {
+        bestCost = incumbent.distanceCost() + incumbent.durationCost()
+                   + incumbent.fixedVehicleCost();
+
+        for (auto const &route : incumbent.routes())
+            bestCost -= route.prizes();
+    }
+
+    // Clients and the columns visiting them, sorted by cost per client.
+    auto const costPerClient = [&](size_t col)
+    {
+        auto const &column = columns[col];
+        return column.cost.get() / static_cast<double>(column.visits.size());
+    };
+
+    std::vector<std::vector<size_t>> clientColumns(data.numLocations());
+    for (size_t col = 0; col != columns.size(); ++col)
+        for (auto const client : columns[col].visits)
+            clientColumns[client].push_back(col);
+
+    for (auto &cols : clientColumns)
+        std::sort(cols.begin(),
+                  cols.end(),
+                  [&](auto col1, auto col2)
+                  { return costPerClient(col1) < costPerClient(col2); });
+
+    // Lower bound on the cost of covering each client. Optional clients need
+    // not be covered, so they only contribute when that can lower the cost.
+    std::vector<double> clientBound(data.numLocations(), 0);
+    double bound = 0;
+    std::vector<size_t> required;
+    for (auto client = data.numDepots(); client != data.numLocations();
+         ++client)
+    {
+        auto const &cols = clientColumns[client];
+        ProblemData::Client const &clientData = data.location(client);
+
+        if (clientData.required && cols.empty())
+            return std::nullopt;  // client cannot be covered by the pool
+
+        if (!cols.empty())
+            clientBound[client] = costPerClient(cols.front());
+
+        if (clientData.required)
+            required.push_back(client);
+        else
+            clientBound[client] = std::min(clientBound[client], 0.0);
+
+        bound += clientBound[client];
+    }
+
+    // We branch on the required client with the fewest columns first, since
+    // those clients constrain the selection the most.
+    std::stable_sort(required.begin(),
+                     required.end(),
+                     [&](auto client1, auto client2)
+                     {
+                         return clientColumns[client1].size()
+                                < clientColumns[client2].size();
+                     });
+
+    std::vector<size_t> sortedColumns(columns.size());
+    std::iota(sortedColumns.begin(), sortedColumns.end(), 0);
+    std::sort(sortedColumns.begin(),
+              sortedColumns.end(),
+              [&](auto col1, auto col2)
+              { return columns[col1].cost < columns[col2].cost; });
+
+    using Clock = std::chrono::steady_clock;
+    auto const deadline
+        = Clock::now() + std::chrono::duration<double>(timeLimit);
+
+    DynamicBitset covered(data.numLocations());
+    std::vector<size_t> vehiclesUsed(data.numVehicleTypes(), 0);
+    std::vector<size_t> selected;
+    std::vector<size_t> bestSelected;
+    size_t numNodes = 0;
+    size_t maxBranches = 0;  // maximum number of branches in each node
+    bool truncated = false;  // whether any node was not fully explored
+    bool timedOut = false;
+
+    auto const canSelect = [&](size_t col)
+    {
+        auto const &column = columns[col];
+        auto const &vehType = data.vehicleType(column.vehicleType);
+        if (vehiclesUsed[column.vehicleType] == vehType.numAvailable)
+            return false;
+
+        return std::none_of(column.visits.begin(),
+                            column.visits.end(),
+                            [&](auto client) { return covered[client]; });
+    };
+
+    auto const doSelect = [&](size_t col, bool value)
+    {
+        auto const &column = columns[col];
+        for (auto const client : column.visits)
+        {
+            covered[client] = value;
+            bound += value ? -clientBound[client] : clientBound[client];
+        }
+
+        if (value)
+        {
+            vehiclesUsed[column.vehicleType]++;
+            selected.push_back(col);
+        }
+        else
+        {
+            vehiclesUsed[column.vehicleType]--;
+            selected.pop_back();
+        }
+    };
+
+    // The selection does not account for client groups, so we need to check
+    // that a new solution is complete before accepting it.
+    auto const makeSolution = [&](std::vector<size_t> const &cols)
+    {
+        std::vector<Solution::Route> routes;
+        routes.reserve(cols.size());
+        for (auto const col : cols)
+            routes.emplace_back(
+                data, columns[col].visits, columns[col].vehicleType);
+
+        return Solution(data, std::move(routes));
+    };
+
+    auto const isValid = [&](std::vector<size_t> const &cols)
+    {
+        if (data.numGroups() == 0)
+            return true;
+
+        auto const solution = makeSolution(cols);
+        return solution.isComplete() && solution.isGroupFeasible();
+    };
+
+    // Depth-first branch-and-bound, that in each node selects one of the
+    // first maxBranches columns to cover the first uncovered required client.
+    std::function<void(Cost, size_t)> search = [&](Cost cost, size_t pos)
+    {
+        if (++numNodes % 256 == 0 && Clock::now() > deadline)
+            timedOut = true;
+
+        if (timedOut)
+            return;
+
+        while (pos != required.size() && covered[required[pos]])
+            ++pos;
+
+        if (pos == required.size())  // all required clients are covered. We
+        {                            // greedily add any columns that further
+            auto const depth = selected.size();  // reduce the cost.
+            for (auto const col : sortedColumns)
+            {
+                if (columns[col].cost >= 0)
+                    break;
+
+                if (canSelect(col))
+                {
+                    cost += columns[col].cost;
+                    doSelect(col, true);
+                }
+            }
+
+            if (cost < bestCost && isValid(selected))
+            {
+                bestCost = cost;
+                bestSelected = selected;
+            }
+
+            while (selected.size() != depth)
+                doSelect(selected.back(), false);
+
+            return;
+        }
+
+        size_t numBranches = 0;
+        for (auto const col : clientColumns[required[pos]])
+        {
+            auto const &column = columns[col];
+            if (!canSelect(col))
+                continue;
+
+            if (numBranches++ == maxBranches)
+            {
+                truncated = true;
+                break;
+            }
+
+            // The bound after selecting this column is the current bound,
+            // minus the bound of the column's clients, plus its cost. If that
+            // exceeds the best cost, selecting this column cannot improve.
+            doSelect(col, true);
+            auto const newCost = cost + column.cost;
+
+            if (newCost.get() + bound < bestCost.get())
+                search(newCost, pos + 1);
+
+            doSelect(col, false);
+        }
+    };
+
+    // We first explore only the most promising columns for each client, and
+    // then gradually widen the search. This quickly finds good selections,
+    // and eventually becomes a complete search if time permits.
+    for (maxBranches = 1; !timedOut; maxBranches *= 2)
+    {
+        truncated = false;
+        search(0, 0);
+
+        if (!truncated)  // then the search was complete, and the best
+            break;       // selection is optimal.
+    }
+
+    if (bestSelected.empty())
+        return std::nullopt;
+
+    return makeSolution(bestSelected);
+}
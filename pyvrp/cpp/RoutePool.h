@@ -0,0 +1,113 @@
+#ifndef PYVRP_ROUTEPOOL_H
+#define PYVRP_ROUTEPOOL_H
+
+#include "Measure.h"
+#include "ProblemData.h"
+#include "Solution.h"
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace pyvrp
+{
+/**
+ * RoutePool(data: ProblemData, max_size: int = 1_000)
+ *
+ * Creates a RoutePool instance.
+ *
+ * The route pool collects distinct feasible routes from the solutions that are
+ * added to it. Routes are deduplicated by hashing their vehicle type and
+ * visits. The pool can then be used to recombine these routes into a new
+ * solution, by (heuristically) solving a set-partitioning problem over the
+ * routes in the pool.
+ *
+ * Parameters
+ * ----------
+ * data
+ *     Data instance.
+ * max_size
+ *     Maximum number of routes in the pool. When the pool is full, the route
+ *     with the highest cost per client is removed to make room for new routes.
+ *     Default 1000.
+ *
+ * Raises
+ * ------
+ * ValueError
+ *     When ``max_size`` is zero.
+ */
+class RoutePool
+{
+    struct Column
+    {
+        std::vector<size_t> visits;
+        size_t vehicleType;
+        Cost cost;    // route costs, minus the value of collected prizes
+        size_t hash;  // of the vehicle type and visits
+    };
+
+    ProblemData const &data;
+    size_t const maxSize;
+
+    std::vector<Column> columns;
+    std::unordered_multimap<size_t, size_t> index;  // hash -> column index
+
+    // Returns whether the pool already contains a column with the given hash,
+    // vehicle type, and visits.
+    [[nodiscard]] bool contains(size_t hash,
+                                size_t vehicleType,
+                                std::vector<size_t> const &visits) const;
+
+    // Removes the column with the highest cost per client.
+    void removeWorst();
+
+public:
+    RoutePool(ProblemData const &data, size_t maxSize = 1'000);
+
+    /**
+     * Adds the feasible routes of the given solution to the pool, if they are
+     * not already in it.
+     *
+     * Parameters
+     * ----------
+     * solution
+     *     Solution whose routes to add.
+     */
+    void add(Solution const &solution);
+
+    /**
+     * Clears the pool.
+     */
+    void clear();
+
+    /**
+     * Returns the number of routes in the pool.
+     */
+    [[nodiscard]] size_t size() const;
+
+    /**
+     * Selects a subset of routes from the pool that visits each required
+     * client exactly once, and each optional client at most once, while
+     * respecting the number of available vehicles of each vehicle type. The
+     * selection is made using a depth-first branch-and-bound search over the
+     * pool's routes, which stops when the time limit is reached.
+     *
+     * Parameters
+     * ----------
+     * incumbent
+     *     Solution that the selected routes must improve on.
+     * time_limit
+     *     Time limit (in seconds) for the search. Default 0.1.
+     *
+     * Returns
+     * -------
+     * Solution
+     *     A new solution that improves on the incumbent, if one was found.
+     *     ``None`` otherwise.
+     */
+    [[nodiscard]] std::optional<Solution>
+    select(Solution const &incumbent, double timeLimit = 0.1) const;
+};
+}  // namespace pyvrp
+
+#endif  // PYVRP_ROUTEPOOL_H
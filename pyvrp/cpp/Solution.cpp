@@ -191,11 +191,12 @@ Solution::Solution(ProblemData const &data, RandomNumberGenerator &rng)
         // with heterogeneous fleet VRP) matters for consistent convergence.
         std::shuffle(vehTypes.begin(), vehTypes.end(), rng);
 
-    routes_.reserve(numRoutes);
+    Routes solRoutes;
+    solRoutes.reserve(numRoutes);
     for (size_t idx = 0; idx != routes.size(); idx++)
-        routes_.emplace_back(data, routes[idx], vehTypes[idx]);
+        solRoutes.emplace_back(data, std::move(routes[idx]), vehTypes[idx]);
 
-    *this = Solution(data, routes_);
+    *this = Solution(data, std::move(solRoutes));
 }
 
 Solution::Solution(ProblemData const &data,
@@ -206,13 +207,14 @@ Solution::Solution(ProblemData const &data,
     for (auto const &visits : routes)
         transformedRoutes.emplace_back(data, visits, 0);
 
-    *this = Solution(data, transformedRoutes);
+    *this = Solution(data, std::move(transformedRoutes));
 }
 
-Solution::Solution(ProblemData const &data, std::vector<Route> const &routes)
-    : routes_(routes), neighbours_(data.numLocations(), std::nullopt)
+Solution::Solution(ProblemData const &data, Routes routes)
+    : routes_(std::move(routes)),
+      neighbours_(data.numLocations(), std::nullopt)
 {
-    if (routes.size() > data.numVehicles())
+    if (routes_.size() > data.numVehicles())
     {
         auto const msg = "Number of routes must not exceed number of vehicles.";
         throw std::runtime_error(msg);
@@ -220,7 +222,7 @@ Solution::Solution(ProblemData const &data, std::vector<Route> const &routes)
 
     std::vector<size_t> visits(data.numLocations(), 0);
     std::vector<size_t> usedVehicles(data.numVehicleTypes(), 0);
-    for (auto const &route : routes)
+    for (auto const &route : routes_)
     {
         if (route.empty())
             throw std::runtime_error("Solution should not have empty routes.");
@@ -283,7 +285,7 @@ Solution::Solution(size_t numClients,
                    Cost uncollectedPrizes,
                    Duration timeWarp,
                    bool isGroupFeasible,
-                   Routes const &routes,
+                   Routes routes,
                    Neighbours neighbours)
     : numClients_(numClients),
       numMissingClients_(numMissingClients),
@@ -298,8 +300,8 @@ Solution::Solution(size_t numClients,
       uncollectedPrizes_(uncollectedPrizes),
       timeWarp_(timeWarp),
       isGroupFeas_(isGroupFeasible),
-      routes_(routes),
-      neighbours_(neighbours)
+      routes_(std::move(routes)),
+      neighbours_(std::move(neighbours))
 {
 }
 
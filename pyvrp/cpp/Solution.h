@@ -15,7 +15,8 @@ namespace pyvrp
 /**
  * Solution(data: ProblemData, routes: Union[list[Route], list[list[int]]])
  *
- * Encodes VRP solutions.
+ * Encodes VRP solutions. Solutions are immutable, and can be shared between
+ * threads.
  *
  * Parameters
  * ----------
@@ -442,12 +443,13 @@ public:
              std::vector<std::vector<Client>> const &routes);
 
     /**
-     * Constructs a solution from the given list of Routes.
+     * Constructs a solution from the given list of Routes. Pass the routes as
+     * an rvalue to avoid copying them.
      *
      * @param data   Data instance describing the problem that's being solved.
      * @param routes Solution's route list.
      */
-    Solution(ProblemData const &data, Routes const &routes);
+    Solution(ProblemData const &data, Routes routes);
 
     // This constructor does *no* validation. Useful when unserialising objects.
     Solution(size_t numClients,
@@ -463,7 +465,7 @@ public:
              Cost uncollectedPrizes,
              Duration timeWarp,
              bool isGroupFeasible,
-             Routes const &routes,
+             Routes routes,
              Neighbours neighbours);
 };
 }  // namespace pyvrp
@@ -45,35 +45,26 @@ SubPopulation::SubPopulation(diversity::DiversityMeasure divOp,
 {
 }
 
-SubPopulation::~SubPopulation()
-{
-    for (auto &item : items)
-        delete item.solution;
-}
-
-void SubPopulation::add(Solution const *solution,
+void SubPopulation::add(std::shared_ptr<Solution const> solution,
                         CostEvaluator const &costEvaluator)
 {
-    // Copy the given solution into a new memory location, and use that from
-    // now on.
-    solution = new Solution(*solution);
-    Item item = {&params, solution, 0.0, {}};
+    Item item = {&params, std::move(solution), 0.0, {}};
 
     for (auto &other : items)  // update distance to other solutions
     {
-        auto const div = divOp(*solution, *other.solution);
+        auto const div = divOp(*item.solution, *other.solution);
         auto cmp = [](auto &elem, auto &value) { return elem.first < value; };
 
         auto &oProx = other.proximity;
         auto place = std::lower_bound(oProx.begin(), oProx.end(), div, cmp);
-        oProx.emplace(place, div, solution);
+        oProx.emplace(place, div, item.solution.get());
 
         auto &iProx = item.proximity;
         place = std::lower_bound(iProx.begin(), iProx.end(), div, cmp);
-        iProx.emplace(place, div, other.solution);
+        iProx.emplace(place, div, other.solution.get());
     }
 
-    items.push_back(item);  // add solution
+    items.push_back(std::move(item));  // add solution
 
     if (size() > params.maxPopSize())
         purge(costEvaluator);
@@ -95,14 +86,13 @@ void SubPopulation::remove(iter const &iterator)
     for (auto &[params, solution, fitness, proximity] : items)
         // Remove solution from other proximities.
         for (size_t idx = 0; idx != proximity.size(); ++idx)
-            if (proximity[idx].second == iterator->solution)
+            if (proximity[idx].second == iterator->solution.get())
             {
                 proximity.erase(proximity.begin() + idx);
                 break;
             }
 
-    delete iterator->solution;  // dispose of manually allocated memory
-    items.erase(iterator);      // before the item is removed.
+    items.erase(iterator);
 }
 
 void SubPopulation::purge(CostEvaluator const &costEvaluator)
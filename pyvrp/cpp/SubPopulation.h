@@ -6,6 +6,7 @@
 #include "diversity/diversity.h"
 
 #include <functional>
+#include <memory>
 #include <vector>
 
 namespace pyvrp
@@ -56,6 +57,9 @@ struct PopulationParams
  * the solution itself, a fitness score (higher is worse), and a list
  * of proximity values to the other solutions in the subpopulation.
  *
+ * A subpopulation must not be modified by multiple threads at the same time.
+ * Different subpopulations may be used concurrently, and may share solutions.
+ *
  * Parameters
  * ----------
  * diversity_op
@@ -75,11 +79,9 @@ public:
 
         PopulationParams const *params;
 
-        // Note that this pointer is not owned by the Item - it is merely a
-        // reference to memory owned and allocated by the SubPopulation this
-        // item is part of. The SubPopulation remains responsible for managing
-        // that memory.
-        Solution const *solution;
+        // Solutions are immutable, so the item shares ownership of its
+        // solution with whoever added it, rather than storing a copy.
+        std::shared_ptr<Solution const> solution;
 
         // Fitness should be used carefully: only directly after updateFitness
         // was called. At any other moment, it will be outdated.
@@ -99,11 +101,10 @@ public:
     SubPopulation(diversity::DiversityMeasure divOp,
                   PopulationParams const &params);
 
-    ~SubPopulation();
-
     /**
      * Adds the given solution to the subpopulation. Survivor selection is
      * automatically triggered when the population reaches its maximum size.
+     * The solution is shared with the caller, and not copied.
      *
      * Parameters
      * ----------
@@ -112,7 +113,8 @@ public:
      * cost_evaluator
      *     CostEvaluator to use to compute the cost.
      */
-    void add(Solution const *solution, CostEvaluator const &costEvaluator);
+    void add(std::shared_ptr<Solution const> solution,
+             CostEvaluator const &costEvaluator);
 
     std::vector<Item>::const_iterator cbegin() const;
 
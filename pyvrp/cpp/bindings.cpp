@@ -4,9 +4,14 @@
 #include "DurationSegment.h"
 #include "DynamicBitset.h"
 #include "LoadSegment.h"
+#include "LowerBound.h"
 #include "Matrix.h"
+#include "Numa.h"
+#include "PlanEvaluation.h"
 #include "ProblemData.h"
 #include "RandomNumberGenerator.h"
+#include "RoadGraph.h"
+#include "RoutePool.h"
 #include "Solution.h"
 #include "SubPopulation.h"
 #include "pyvrp_docs.h"
@@ -17,6 +22,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <memory>
 #include <sstream>
 #include <variant>
 
@@ -28,13 +34,18 @@ using pyvrp::DurationSegment;
 using pyvrp::DynamicBitset;
 using pyvrp::LoadSegment;
 using pyvrp::Matrix;
+using pyvrp::PlanEvaluation;
 using pyvrp::PopulationParams;
 using pyvrp::ProblemData;
 using pyvrp::RandomNumberGenerator;
+using pyvrp::readOnlyColumn;
+using pyvrp::readOnlyMember;
+using pyvrp::RoadGraph;
+using pyvrp::RoutePool;
 using pyvrp::Solution;
 using pyvrp::SubPopulation;
 
-PYBIND11_MODULE(_pyvrp, m)
+PYVRP_MODULE(_pyvrp, m)
 {
     py::class_<DynamicBitset>(m, "DynamicBitset", DOC(pyvrp, DynamicBitset))
         .def(py::init<size_t>(), py::arg("num_bits"))
@@ -286,6 +297,39 @@ PYBIND11_MODULE(_pyvrp, m)
              &ProblemData::durationMatrices,
              py::return_value_policy::reference_internal,
              DOC(pyvrp, ProblemData, durationMatrices))
+        .def("x",
+             readOnlyColumn<pyvrp::Value>(&ProblemData::x),
+             DOC(pyvrp, ProblemData, x))
+        .def("y",
+             readOnlyColumn<pyvrp::Value>(&ProblemData::y),
+             DOC(pyvrp, ProblemData, y))
+        .def("delivery",
+             readOnlyColumn<pyvrp::Value>(&ProblemData::delivery),
+             DOC(pyvrp, ProblemData, delivery))
+        .def("pickup",
+             readOnlyColumn<pyvrp::Value>(&ProblemData::pickup),
+             DOC(pyvrp, ProblemData, pickup))
+        .def("service_duration",
+             readOnlyColumn<pyvrp::Value>(&ProblemData::serviceDuration),
+             DOC(pyvrp, ProblemData, serviceDuration))
+        .def("tw_early",
+             readOnlyColumn<pyvrp::Value>(&ProblemData::twEarly),
+             DOC(pyvrp, ProblemData, twEarly))
+        .def("tw_late",
+             readOnlyColumn<pyvrp::Value>(&ProblemData::twLate),
+             DOC(pyvrp, ProblemData, twLate))
+        .def("release_time",
+             readOnlyColumn<pyvrp::Value>(&ProblemData::releaseTime),
+             DOC(pyvrp, ProblemData, releaseTime))
+        .def("prize",
+             readOnlyColumn<pyvrp::Value>(&ProblemData::prize),
+             DOC(pyvrp, ProblemData, prize))
+        .def("required",
+             readOnlyColumn<bool>(&ProblemData::required),
+             DOC(pyvrp, ProblemData, required))
+        .def("group_membership",
+             readOnlyColumn<pyvrp::Value>(&ProblemData::groupMembership),
+             DOC(pyvrp, ProblemData, groupMembership))
         .def("centroid",
              &ProblemData::centroid,
              py::return_value_policy::reference_internal,
@@ -459,15 +503,17 @@ PYBIND11_MODULE(_pyvrp, m)
                  return stream.str();
              });
 
-    py::class_<Solution>(m, "Solution", DOC(pyvrp, Solution))
+    // Solutions are held by shared pointer, so subpopulations can share them
+    // with Python rather than storing their own copies.
+    py::class_<Solution, std::shared_ptr<Solution>>(
+        m, "Solution", DOC(pyvrp, Solution))
         // Note, the order of constructors is important! Since Solution::Route
         // implements __len__ and __getitem__, it can also be converted to
         // std::vector<size_t> and thus a list of Routes is a valid argument
         // for both constructors. We want to avoid using the second constructor
         // since that would lose the vehicle types associations. As pybind11
         // will use the first matching constructor we put this one first.
-        .def(py::init<ProblemData const &,
-                      std::vector<Solution::Route> const &>(),
+        .def(py::init<ProblemData const &, std::vector<Solution::Route>>(),
              py::arg("data"),
              py::arg("routes"))
         .def(py::init<ProblemData const &,
@@ -650,17 +696,18 @@ PYBIND11_MODULE(_pyvrp, m)
         .def_readonly("ub_diversity", &PopulationParams::ubDiversity);
 
     py::class_<SubPopulation::Item>(m, "SubPopulationItem")
-        .def_readonly("solution",
-                      &SubPopulation::Item::solution,
-                      py::return_value_policy::reference_internal,
-                      R"doc(
-                            Solution for this SubPopulationItem.
+        .def_property_readonly(
+            "solution",
+            [](SubPopulation::Item const &item)
+            { return std::const_pointer_cast<Solution>(item.solution); },
+            R"doc(
+                Solution for this SubPopulationItem.
 
-                            Returns
-                            -------
-                            Solution
-                                Solution for this SubPopulationItem.
-                      )doc")
+                Returns
+                -------
+                Solution
+                    Solution for this SubPopulationItem.
+            )doc")
         .def_readonly("fitness",
                       &SubPopulation::Item::fitness,
                       R"doc(
@@ -698,11 +745,15 @@ PYBIND11_MODULE(_pyvrp, m)
              py::arg("diversity_op"),
              py::arg("params"),
              py::keep_alive<1, 3>())  // keep params alive
-        .def("add",
-             &SubPopulation::add,
-             py::arg("solution"),
-             py::arg("cost_evaluator"),
-             DOC(pyvrp, SubPopulation, add))
+        .def(
+            "add",
+            [](SubPopulation &subPop,
+               std::shared_ptr<Solution> solution,
+               CostEvaluator const &costEvaluator)
+            { subPop.add(std::move(solution), costEvaluator); },
+            py::arg("solution"),
+            py::arg("cost_evaluator"),
+            DOC(pyvrp, SubPopulation, add))
         .def("__len__", &SubPopulation::size)
         .def(
             "__getitem__",
@@ -730,6 +781,206 @@ PYBIND11_MODULE(_pyvrp, m)
              py::arg("cost_evaluator"),
              DOC(pyvrp, SubPopulation, updateFitness));
 
+    py::class_<RoutePool>(m, "RoutePool", DOC(pyvrp, RoutePool))
+        .def(py::init<ProblemData const &, size_t>(),
+             py::arg("data"),
+             py::arg("max_size") = 1'000,
+             py::keep_alive<1, 2>())  // keep data alive
+        .def("add",
+             &RoutePool::add,
+             py::arg("solution"),
+             DOC(pyvrp, RoutePool, add))
+        .def("clear", &RoutePool::clear, DOC(pyvrp, RoutePool, clear))
+        .def("__len__", &RoutePool::size)
+        .def("select",
+             &RoutePool::select,
+             py::arg("incumbent"),
+             py::arg("time_limit") = 0.1,
+             DOC(pyvrp, RoutePool, select));
+
+    // Copies the given measure values into a new numpy array of the given
+    // shape. Measures have the same layout as pyvrp::Value.
+    auto const toArray = [](auto const *data, std::vector<size_t> shape)
+    {
+        py::array_t<pyvrp::Value> array(shape);
+        auto const *values = reinterpret_cast<pyvrp::Value const *>(data);
+        std::copy(values, values + array.size(), array.mutable_data());
+        return array;
+    };
+
+    py::class_<RoadGraph>(m, "RoadGraph", DOC(pyvrp, RoadGraph))
+        .def(py::init<std::string const &, size_t>(),
+             py::arg("path"),
+             py::arg("max_cached_rows") = 1'000)
+        .def("num_nodes", &RoadGraph::numNodes, DOC(pyvrp, RoadGraph, numNodes))
+        .def("num_locations",
+             &RoadGraph::numLocations,
+             DOC(pyvrp, RoadGraph, numLocations))
+        .def("num_cached_rows",
+             &RoadGraph::numCachedRows,
+             DOC(pyvrp, RoadGraph, numCachedRows))
+        .def("set_locations",
+             &RoadGraph::setLocations,
+             py::arg("nodes"),
+             DOC(pyvrp, RoadGraph, setLocations))
+        .def("add_location",
+             &RoadGraph::addLocation,
+             py::arg("node"),
+             DOC(pyvrp, RoadGraph, addLocation))
+        .def("nearest_node",
+             &RoadGraph::nearestNode,
+             py::arg("x"),
+             py::arg("y"),
+             DOC(pyvrp, RoadGraph, nearestNode))
+        .def(
+            "row",
+            [toArray](RoadGraph &graph, size_t location)
+            {
+                auto const row = graph.row(location);
+                auto const size = row.distances.size();
+                return py::make_tuple(toArray(row.distances.data(), {size}),
+                                      toArray(row.durations.data(), {size}));
+            },
+            py::arg("location"),
+            DOC(pyvrp, RoadGraph, row))
+        .def(
+            "matrices",
+            [toArray](RoadGraph const &graph, size_t numThreads)
+            {
+                auto const [distMat, durMat] = [&]()
+                {
+                    py::gil_scoped_release release;
+                    return graph.matrices(numThreads);
+                }();
+
+                auto const size = distMat.numRows();
+                return py::make_tuple(toArray(distMat.data(), {size, size}),
+                                      toArray(durMat.data(), {size, size}));
+            },
+            py::arg("num_threads") = 1,
+            DOC(pyvrp, RoadGraph, matrices));
+
+    using Value = pyvrp::Value;
+    py::class_<PlanEvaluation>(m, "PlanEvaluation", DOC(pyvrp, PlanEvaluation))
+        .def_property_readonly(
+            "route_distance",
+            readOnlyMember<Value>(&PlanEvaluation::routeDistance))
+        .def_property_readonly(
+            "route_duration",
+            readOnlyMember<Value>(&PlanEvaluation::routeDuration))
+        .def_property_readonly(
+            "route_excess_load",
+            readOnlyMember<Value>(&PlanEvaluation::routeExcessLoad))
+        .def_property_readonly(
+            "route_time_warp",
+            readOnlyMember<Value>(&PlanEvaluation::routeTimeWarp))
+        .def_property_readonly(
+            "route_excess_distance",
+            readOnlyMember<Value>(&PlanEvaluation::routeExcessDistance))
+        .def_property_readonly(
+            "route_cost", readOnlyMember<Value>(&PlanEvaluation::routeCost))
+        .def_property_readonly(
+            "route_feasible",
+            readOnlyMember<bool>(&PlanEvaluation::routeFeasible))
+        .def_property_readonly(
+            "distance", readOnlyMember<Value>(&PlanEvaluation::distance))
+        .def_property_readonly(
+            "duration", readOnlyMember<Value>(&PlanEvaluation::duration))
+        .def_property_readonly(
+            "distance_cost",
+            readOnlyMember<Value>(&PlanEvaluation::distanceCost))
+        .def_property_readonly(
+            "duration_cost",
+            readOnlyMember<Value>(&PlanEvaluation::durationCost))
+        .def_property_readonly(
+            "fixed_vehicle_cost",
+            readOnlyMember<Value>(&PlanEvaluation::fixedVehicleCost))
+        .def_property_readonly(
+            "uncollected_prizes",
+            readOnlyMember<Value>(&PlanEvaluation::uncollectedPrizes))
+        .def_property_readonly(
+            "excess_load", readOnlyMember<Value>(&PlanEvaluation::excessLoad))
+        .def_property_readonly(
+            "time_warp", readOnlyMember<Value>(&PlanEvaluation::timeWarp))
+        .def_property_readonly(
+            "excess_distance",
+            readOnlyMember<Value>(&PlanEvaluation::excessDistance))
+        .def_property_readonly(
+            "penalised_cost",
+            readOnlyMember<Value>(&PlanEvaluation::penalisedCost))
+        .def_property_readonly(
+            "cost", readOnlyMember<Value>(&PlanEvaluation::cost))
+        .def_property_readonly(
+            "feasible", readOnlyMember<bool>(&PlanEvaluation::feasible));
+
+    // Flat index arrays are taken as contiguous numpy arrays, so that large
+    // batches of plans are not converted element by element.
+    auto constexpr style = py::array::c_style | py::array::forcecast;
+    using Indices = py::array_t<size_t, style>;
+    auto const asSpan = [](Indices const &arr)
+    { return std::span<size_t const>(arr.data(), arr.size()); };
+
+    m.def(
+        "evaluate_plans",
+        [asSpan](ProblemData const &data,
+                 CostEvaluator const &costEvaluator,
+                 Indices const &visits,
+                 Indices const &routeOffsets,
+                 Indices const &vehicleTypes,
+                 Indices const &planOffsets,
+                 size_t numThreads)
+        {
+            py::gil_scoped_release release;
+            return pyvrp::evaluatePlans(data,
+                                        costEvaluator,
+                                        asSpan(visits),
+                                        asSpan(routeOffsets),
+                                        asSpan(vehicleTypes),
+                                        asSpan(planOffsets),
+                                        numThreads);
+        },
+        py::arg("data"),
+        py::arg("cost_evaluator"),
+        py::arg("visits"),
+        py::arg("route_offsets"),
+        py::arg("vehicle_types"),
+        py::arg("plan_offsets"),
+        py::arg("num_threads") = 1,
+        DOC(pyvrp, evaluatePlans));
+
+    m.def(
+        "lower_bound",
+        [](ProblemData const &data)
+        {
+            py::gil_scoped_release release;
+            return pyvrp::lowerBound(data);
+        },
+        py::arg("data"),
+        DOC(pyvrp, lowerBound));
+
+    m.def("num_numa_nodes", &pyvrp::numNumaNodes, DOC(pyvrp, numNumaNodes));
+
+    m.def("numa_node_cpus",
+          &pyvrp::numaNodeCpus,
+          py::arg("node"),
+          DOC(pyvrp, numaNodeCpus));
+
+    m.def("current_numa_node",
+          &pyvrp::currentNumaNode,
+          DOC(pyvrp, currentNumaNode));
+
+    m.def("bind_to_numa_node",
+          &pyvrp::bindToNumaNode,
+          py::arg("node"),
+          DOC(pyvrp, bindToNumaNode));
+
+    m.def("replicate_on_numa_node",
+          &pyvrp::replicateOnNumaNode,
+          py::arg("data"),
+          py::arg("node"),
+          py::call_guard<py::gil_scoped_release>(),
+          DOC(pyvrp, replicateOnNumaNode));
+
     py::class_<DistanceSegment>(
         m, "DistanceSegment", DOC(pyvrp, DistanceSegment))
         .def(py::init<size_t, size_t, pyvrp::Distance>(),
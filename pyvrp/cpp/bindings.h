@@ -4,7 +4,9 @@
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 
+#include <algorithm>
 #include <type_traits>
+#include <vector>
 
 namespace pybind11::detail
 {
@@ -33,8 +35,8 @@ template <typename T> struct type_caster<pyvrp::Matrix<T>>
         if (buf.size() == 0)  // then the default constructed object is already
             return true;      // OK, and we have nothing to do.
 
-        std::vector<T> data = {buf.data(), buf.data() + buf.size()};
-        value = pyvrp::Matrix<T>(data, buf.shape(0), buf.shape(1));
+        value = pyvrp::Matrix<T>(buf.shape(0), buf.shape(1));
+        std::copy(buf.data(), buf.data() + buf.size(), value.data());
 
         return true;
     }
@@ -101,3 +103,60 @@ template <pyvrp::MeasureType T> struct type_caster<pyvrp::Measure<T>>
     }
 };
 }  // namespace pybind11::detail
+
+namespace pyvrp
+{
+// Returns a read-only, one-dimensional numpy view of the given vector, with
+// elements interpreted as Elem. No data is copied: the view keeps the given
+// base object alive instead, and thus should only be used for vectors owned by
+// that base object.
+template <typename Elem, typename T>
+pybind11::array_t<Elem> asReadOnlyArray(std::vector<T> const &vec,
+                                        pybind11::handle base)
+{
+    static_assert(sizeof(T) == sizeof(Elem));
+
+    pybind11::array_t<Elem> array
+        = {{vec.size()},                                 // shape
+           {sizeof(Elem)},                               // strides
+           reinterpret_cast<Elem const *>(vec.data()),  // data
+           base};                                        // base
+
+    // See the Matrix type caster above: the underlying data is const, so the
+    // view must not be writeable from Python.
+    pybind11::detail::array_proxy(array.ptr())->flags
+        &= ~pybind11::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+
+    return array;
+}
+
+// Wraps a getter returning a vector into a function that returns a read-only
+// numpy view of that vector. Suitable for binding column accessors.
+template <typename Elem, typename Class, typename T>
+auto readOnlyColumn(std::vector<T> const &(Class::*getter)() const)
+{
+    return [getter](pybind11::object self)
+    {
+        auto const &obj = self.cast<Class const &>();
+        return asReadOnlyArray<Elem>((obj.*getter)(), self);
+    };
+}
+
+// As readOnlyColumn, but for public vector members. Suitable for binding plain
+// result structs.
+template <typename Elem, typename Class, typename T>
+auto readOnlyMember(std::vector<T> Class::*member)
+{
+    return [member](pybind11::object self)
+    {
+        auto const &obj = self.cast<Class const &>();
+        return asReadOnlyArray<Elem>(obj.*member, self);
+    };
+}
+}  // namespace pyvrp
+
+// Declares an extension module. The modules do not depend on the GIL for their
+// thread safety, so they declare support for free-threaded Python. This needs
+// pybind11 2.13 or later, which the build requires.
+#define PYVRP_MODULE(name, variable)                                           \
+    PYBIND11_MODULE(name, variable, pybind11::mod_gil_not_used())
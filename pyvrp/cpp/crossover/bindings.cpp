@@ -1,12 +1,15 @@
+#include "bindings.h"
 #include "crossover_docs.h"
 #include "ordered_crossover.h"
 #include "selective_route_exchange.h"
+#include "split.h"
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
 namespace py = pybind11;
 
-PYBIND11_MODULE(_crossover, m)
+PYVRP_MODULE(_crossover, m)
 {
     m.def("ordered_crossover",
           &pyvrp::crossover::orderedCrossover,
@@ -15,6 +18,14 @@ PYBIND11_MODULE(_crossover, m)
           py::arg("indices"),
           DOC(pyvrp, crossover, orderedCrossover));
 
+    m.def("ordered_split_crossover",
+          &pyvrp::crossover::orderedSplitCrossover,
+          py::arg("parents"),
+          py::arg("data"),
+          py::arg("cost_evaluator"),
+          py::arg("indices"),
+          DOC(pyvrp, crossover, orderedSplitCrossover));
+
     m.def("selective_route_exchange",
           &pyvrp::crossover::selectiveRouteExchange,
           py::arg("parents"),
@@ -23,4 +34,11 @@ PYBIND11_MODULE(_crossover, m)
           py::arg("start_indices"),
           py::arg("num_moved_routes"),
           DOC(pyvrp, crossover, selectiveRouteExchange));
+
+    m.def("split",
+          &pyvrp::crossover::split,
+          py::arg("tour"),
+          py::arg("data"),
+          py::arg("cost_evaluator"),
+          DOC(pyvrp, crossover, split));
 }
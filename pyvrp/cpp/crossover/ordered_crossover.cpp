@@ -1,6 +1,7 @@
 #include "ordered_crossover.h"
 
 #include "DynamicBitset.h"
+#include "split.h"
 
 #include <algorithm>
 #include <cassert>
@@ -9,59 +10,102 @@
 namespace
 {
 using Client = size_t;
+using Tour = std::vector<Client>;
 
 // Depot value, which is never in a route (since it's not a client). We use
 // this as filler to account for possibly missing clients.
 static constexpr size_t UNUSED = 0;
-}  // namespace
 
-pyvrp::Solution pyvrp::crossover::orderedCrossover(
-    std::pair<Solution const *, Solution const *> const &parents,
-    ProblemData const &data,
-    std::pair<size_t, size_t> const &indices)
+// Performs OX on the two given tours, and returns the offspring tour.
+Tour crossTours(Tour const &tour1,
+                Tour const &tour2,
+                pyvrp::ProblemData const &data,
+                std::pair<size_t, size_t> const &indices)
 {
-    assert(data.numVehicles() == 1);
-    assert(parents.first->numClients() > 0 && parents.second->numClients() > 0);
-
     auto const [start, end] = indices;
     auto const numClients = data.numClients();
 
-    // New route. This route is initially empty, indicated by all UNUSED
-    // values. Any such values that remain after crossover are filtered away.
-    std::vector<Client> newRoute(numClients, UNUSED);
-    DynamicBitset isInserted(data.numLocations());  // tracks inserted clients
+    // New tour. This tour is initially empty, indicated by all UNUSED values.
+    // Any such values that remain after crossover are filtered away.
+    Tour newTour(numClients, UNUSED);
+    pyvrp::DynamicBitset isInserted(data.numLocations());  // inserted clients
 
-    // Insert the clients from the first route into the new route, from start
-    // to end (possibly wrapping around the end of the route).
+    // Insert the clients from the first tour into the new tour, from start to
+    // end (possibly wrapping around the end of the tour).
     size_t insertIdx = start;
-    auto const &route1 = parents.first->routes()[0];
-    for (; insertIdx % route1.size() != end % route1.size(); ++insertIdx)
+    for (; insertIdx % tour1.size() != end % tour1.size(); ++insertIdx)
     {
-        newRoute[insertIdx % numClients] = route1[insertIdx % route1.size()];
-        isInserted[route1[insertIdx % route1.size()]] = true;
+        newTour[insertIdx % numClients] = tour1[insertIdx % tour1.size()];
+        isInserted[tour1[insertIdx % tour1.size()]] = true;
     }
 
-    // Fill the route with clients from the second parent, in the order of
-    // their visits in the second route.
-    auto const &route2 = parents.second->routes()[0];
-    for (size_t idx = 0; idx != route2.size(); ++idx)
+    // Fill the tour with clients from the second parent, in the order of
+    // their visits in the second tour.
+    for (size_t idx = 0; idx != tour2.size(); ++idx)
     {
-        Client const client = route2[(end + idx) % route2.size()];
+        Client const client = tour2[(end + idx) % tour2.size()];
         if (!isInserted[client])
         {
-            newRoute[insertIdx % numClients] = client;
+            newTour[insertIdx % numClients] = client;
             insertIdx++;
         }
     }
 
-    // Remove the UNUSED values from the new route. These were needed because
+    // Remove the UNUSED values from the new tour. These were needed because
     // we cannot assume both parent solutions have all the same clients (for
     // example, solutions to instances with optional clients typically do not).
-    std::vector<Client> offspring;
-    std::copy_if(newRoute.begin(),
-                 newRoute.end(),
+    Tour offspring;
+    std::copy_if(newTour.begin(),
+                 newTour.end(),
                  std::back_inserter(offspring),
                  [](auto client) { return client != UNUSED; });
 
+    return offspring;
+}
+
+// Concatenates the visits of all routes in the given solution.
+Tour giantTour(pyvrp::Solution const &solution)
+{
+    Tour tour;
+    tour.reserve(solution.numClients());
+
+    for (auto const &route : solution.routes())
+        tour.insert(tour.end(), route.begin(), route.end());
+
+    return tour;
+}
+}  // namespace
+
+pyvrp::Solution pyvrp::crossover::orderedCrossover(
+    std::pair<Solution const *, Solution const *> const &parents,
+    ProblemData const &data,
+    std::pair<size_t, size_t> const &indices)
+{
+    assert(data.numVehicles() == 1);
+    assert(parents.first->numClients() > 0 && parents.second->numClients() > 0);
+
+    auto const &route1 = parents.first->routes()[0];
+    auto const &route2 = parents.second->routes()[0];
+    auto const offspring = crossTours(route1.visits(),
+                                      route2.visits(),
+                                      data,
+                                      indices);
+
     return {data, {offspring}};
 }
+
+pyvrp::Solution pyvrp::crossover::orderedSplitCrossover(
+    std::pair<Solution const *, Solution const *> const &parents,
+    ProblemData const &data,
+    CostEvaluator const &costEvaluator,
+    std::pair<size_t, size_t> const &indices)
+{
+    assert(parents.first->numClients() > 0 && parents.second->numClients() > 0);
+
+    auto const offspring = crossTours(giantTour(*parents.first),
+                                      giantTour(*parents.second),
+                                      data,
+                                      indices);
+
+    return split(offspring, data, costEvaluator);
+}
@@ -27,6 +27,26 @@ Solution
 orderedCrossover(std::pair<Solution const *, Solution const *> const &parents,
                  ProblemData const &data,
                  std::pair<size_t, size_t> const &indices);
+
+/**
+ * Performs an ordered crossover (OX) operation between the giant tours of the
+ * two given parents, and splits the resulting offspring tour into routes. The
+ * giant tour of a solution concatenates the visits of all its routes.
+ *
+ * @param parents        The parent solutions.
+ * @param data           The problem data.
+ * @param costEvaluator  Cost evaluator used to split the offspring tour.
+ * @param indices        Tuple of [start, end) indices of the first giant tour
+ *                       to use.
+ * @return A new offspring.
+ */
+// The above is an internal docstring: the OX operator is wrapped on the Python
+// side and also documented there.
+Solution orderedSplitCrossover(
+    std::pair<Solution const *, Solution const *> const &parents,
+    ProblemData const &data,
+    CostEvaluator const &costEvaluator,
+    std::pair<size_t, size_t> const &indices);
 }  // namespace pyvrp::crossover
 
 #endif  // PYVRP_ORDERED_CROSSOVER_H
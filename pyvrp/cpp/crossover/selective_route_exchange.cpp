@@ -216,16 +216,26 @@ pyvrp::Solution pyvrp::crossover::selectiveRouteExchange(
     for (size_t r = 0; r < nRoutesA; r++)
     {
         if (!visits1[r].empty())
-            routes1.emplace_back(data, visits1[r], routesA[r].vehicleType());
+        {
+            auto const vehType = routesA[r].vehicleType();
+            routes1.emplace_back(data, std::move(visits1[r]), vehType);
+        }
 
         if (!visits2[r].empty())
-            routes2.emplace_back(data, visits2[r], routesA[r].vehicleType());
+        {
+            auto const vehType = routesA[r].vehicleType();
+            routes2.emplace_back(data, std::move(visits2[r]), vehType);
+        }
     }
 
-    auto const sol1 = Solution(data, routes1);
-    auto const sol2 = Solution(data, routes2);
+    auto sol1 = Solution(data, std::move(routes1));
+    auto sol2 = Solution(data, std::move(routes2));
 
+    // Return by name, so the selected solution is moved rather than copied.
     auto const cost1 = costEvaluator.penalisedCost(sol1);
     auto const cost2 = costEvaluator.penalisedCost(sol2);
-    return cost1 < cost2 ? sol1 : sol2;
+    if (cost1 < cost2)
+        return sol1;
+
+    return sol2;
 }
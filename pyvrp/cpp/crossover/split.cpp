@@ -0,0 +1,384 @@
+#include "split.h"
+
+#include "DistanceSegment.h"
+#include "DurationSegment.h"
+#include "LoadSegment.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+
+using pyvrp::Cost;
+using pyvrp::Distance;
+using pyvrp::Duration;
+using pyvrp::Load;
+
+namespace
+{
+// Potential of tour positions that cannot be reached.
+Cost const UNREACHABLE = std::numeric_limits<Cost>::max();
+
+// Computes (layers of) the shortest path through the auxiliary graph of the
+// giant tour. Positions in the tour are 1-indexed; position 0 is the depot.
+// An arc (i, j) with i < j corresponds to the route visiting the clients at
+// positions i + 1, ..., j of the tour.
+class Splitter
+{
+    pyvrp::ProblemData const &data;
+    pyvrp::CostEvaluator const &costEvaluator;
+    pyvrp::ProblemData::VehicleType const &vehType;
+    pyvrp::Matrix<Distance> const &distMat;
+    pyvrp::Matrix<Duration> const &durMat;
+
+    std::vector<size_t> tour;  // tour[0] is the depot
+
+    // Cumulative data for the linear split. cumDist[j] is the distance from
+    // the client at position 1 to that at position j; cumLoad[j] the load of
+    // the clients up to and including position j.
+    std::vector<Distance> cumDist;
+    std::vector<Load> cumLoad;
+
+    bool isLinear_;
+
+    [[nodiscard]] bool isLinear() const;
+
+    // Cost of the route from i to j, using the cumulative data. Only valid
+    // when the split is linear.
+    [[nodiscard]] Cost linearCost(size_t i, size_t j) const;
+
+    // Linear split of Vidal (2016), based on the dominance of predecessors.
+    void linearLayer(std::vector<Cost> const &in,
+                     std::vector<Cost> &out,
+                     std::vector<size_t> &pred) const;
+
+    // Bellman split that evaluates all arcs (i, j) using route segments.
+    void bellmanLayer(std::vector<Cost> const &in,
+                      std::vector<Cost> &out,
+                      std::vector<size_t> &pred) const;
+
+public:
+    [[nodiscard]] size_t size() const;
+
+    // Computes the shortest paths through the arcs of the auxiliary graph,
+    // starting from the potentials in ``in``. Stores the resulting potentials
+    // and predecessors in ``out`` and ``pred``. The unlimited fleet split
+    // passes the same vector for ``in`` and ``out``.
+    void layer(std::vector<Cost> const &in,
+               std::vector<Cost> &out,
+               std::vector<size_t> &pred) const;
+
+    // Converts the predecessors into routes.
+    [[nodiscard]] std::vector<pyvrp::Solution::Route>
+    routes(std::vector<std::vector<size_t>> const &preds) const;
+
+    Splitter(std::vector<size_t> const &tour,
+             pyvrp::ProblemData const &data,
+             pyvrp::CostEvaluator const &costEvaluator);
+};
+
+Splitter::Splitter(std::vector<size_t> const &giantTour,
+                   pyvrp::ProblemData const &data,
+                   pyvrp::CostEvaluator const &costEvaluator)
+    : data(data),
+      costEvaluator(costEvaluator),
+      vehType(data.vehicleType(0)),
+      distMat(data.distanceMatrix(vehType.profile)),
+      durMat(data.durationMatrix(vehType.profile)),
+      cumDist(giantTour.size() + 1, 0),
+      cumLoad(giantTour.size() + 1, 0)
+{
+    tour.reserve(giantTour.size() + 1);
+    tour.push_back(vehType.depot);
+
+    for (auto const client : giantTour)
+    {
+        if (client < data.numDepots() || client >= data.numLocations())
+            throw std::invalid_argument("Tour contains invalid clients.");
+
+        tour.push_back(client);
+    }
+
+    auto const &delivery = data.delivery();
+    auto const &pickup = data.pickup();
+    for (size_t pos = 1; pos != tour.size(); ++pos)
+    {
+        auto const client = tour[pos];
+        cumLoad[pos] = cumLoad[pos - 1] + delivery[client] + pickup[client];
+
+        if (pos > 1)
+            cumDist[pos] = cumDist[pos - 1] + distMat(tour[pos - 1], client);
+    }
+
+    isLinear_ = isLinear();
+}
+
+bool Splitter::isLinear() const
+{
+    // The dominance rules of the linear split require that route costs are
+    // determined by distance and load, and that the penalty on load is linear
+    // in the total load of the route's clients.
+    if (vehType.unitDurationCost != 0
+        || vehType.maxDistance != std::numeric_limits<Distance>::max())
+        return false;
+
+    auto const &delivery = data.delivery();
+    auto const &pickup = data.pickup();
+    bool hasDelivery = false;
+    bool hasPickup = false;
+    for (size_t pos = 1; pos != tour.size(); ++pos)
+    {
+        hasDelivery |= delivery[tour[pos]] > 0;
+        hasPickup |= pickup[tour[pos]] > 0;
+    }
+
+    if (hasDelivery && hasPickup)
+        return false;
+
+#ifndef PYVRP_NO_TIME_WINDOWS
+    // Time warp cannot occur when there are no duration limits, time window
+    // closing times, or release times. Early opening times are fine, since
+    // those only result in waiting time.
+    auto const maxDuration = std::numeric_limits<Duration>::max();
+    if (vehType.maxDuration != maxDuration || vehType.twLate != maxDuration
+        || data.twLate()[vehType.depot] != maxDuration)
+        return false;
+
+    auto const &twLate = data.twLate();
+    auto const &releaseTime = data.releaseTime();
+    for (size_t pos = 1; pos != tour.size(); ++pos)
+        if (twLate[tour[pos]] != maxDuration || releaseTime[tour[pos]] != 0)
+            return false;
+#endif
+
+    return true;
+}
+
+size_t Splitter::size() const { return tour.size() - 1; }
+
+Cost Splitter::linearCost(size_t i, size_t j) const
+{
+    assert(i < j);
+
+    auto const dist = distMat(tour[0], tour[i + 1]) + cumDist[j]
+                      - cumDist[i + 1] + distMat(tour[j], tour[0]);
+
+    auto const load = cumLoad[j] - cumLoad[i];
+    return vehType.fixedCost
+           + vehType.unitDistanceCost * static_cast<Cost>(dist)
+           + costEvaluator.loadPenalty(load, vehType.capacity);
+}
+
+void Splitter::linearLayer(std::vector<Cost> const &in,
+                           std::vector<Cost> &out,
+                           std::vector<size_t> &pred) const
+{
+    auto const cost
+        = [&](size_t i, size_t j) { return in[i] + linearCost(i, j); };
+
+    // Part of the cost of a route starting after i that only depends on i.
+    auto const base = [&](size_t i)
+    {
+        auto const dist = distMat(tour[0], tour[i + 1]) - cumDist[i + 1];
+        return in[i] + vehType.unitDistanceCost * static_cast<Cost>(dist);
+    };
+
+    // Predecessor i dominates a later predecessor j when i is better, even if
+    // all load between them incurs a penalty.
+    auto const dominates = [&](size_t i, size_t j)
+    {
+        auto const load = cumLoad[j] - cumLoad[i];
+        return base(j) > base(i) + costEvaluator.loadPenalty(load, 0);
+    };
+
+    // Later predecessor j dominates i when j is not worse; the penalty on load
+    // of routes starting after j never exceeds that of routes after i.
+    auto const dominatesRight
+        = [&](size_t i, size_t j) { return base(j) <= base(i); };
+
+    // Double-ended queue of non-dominated predecessors. Each position is added
+    // to it at most once, so we can implement it as a simple array.
+    std::vector<size_t> queue(size() + 1);
+    size_t front = 0;
+    size_t back = 0;
+
+    if (in[0] != UNREACHABLE)
+        queue[back++] = 0;
+
+    for (size_t pos = 1; pos <= size(); ++pos)
+    {
+        if (front != back)
+        {
+            out[pos] = cost(queue[front], pos);
+            pred[pos] = queue[front];
+        }
+
+        if (pos == size())
+            break;
+
+        if (in[pos] != UNREACHABLE
+            && (front == back || !dominates(queue[back - 1], pos)))
+        {
+            while (front != back && dominatesRight(queue[back - 1], pos))
+                back--;
+
+            queue[back++] = pos;
+        }
+
+        // Remove predecessors from the front that are no longer better than
+        // the next one in line for the next position.
+        while (back - front > 1
+               && cost(queue[front], pos + 1)
+                      >= cost(queue[front + 1], pos + 1))
+            front++;
+    }
+}
+
+void Splitter::bellmanLayer(std::vector<Cost> const &in,
+                            std::vector<Cost> &out,
+                            std::vector<size_t> &pred) const
+{
+    // Time window is limited by both the depot open and closing times, and
+    // the vehicle's start and end of shift, whichever is tighter.
+    auto const depot = vehType.depot;
+    pyvrp::DurationSegment const depotDS(
+        depot,
+        depot,
+        0,
+        0,
+        std::max(data.twEarly()[depot], vehType.twEarly),
+        std::min(data.twLate()[depot], vehType.twLate),
+        0);
+
+    for (size_t start = 0; start != size(); ++start)
+    {
+        if (in[start] == UNREACHABLE)
+            continue;
+
+        Distance dist = 0;
+        auto ds = depotDS;
+        pyvrp::LoadSegment ls(0, 0, 0);
+
+        for (size_t pos = start + 1; pos <= size(); ++pos)
+        {
+            auto const client = tour[pos];
+            dist += distMat(pos == start + 1 ? depot : tour[pos - 1], client);
+            ds = pyvrp::DurationSegment::merge(
+                durMat, ds, pyvrp::DurationSegment(data, client));
+            ls = pyvrp::LoadSegment::merge(ls,
+                                           pyvrp::LoadSegment(data, client));
+
+            auto const routeDist = dist + distMat(client, depot);
+            auto const routeDS
+                = pyvrp::DurationSegment::merge(durMat, ds, depotDS);
+
+            auto const routeCost
+                = vehType.fixedCost
+                  + vehType.unitDistanceCost * static_cast<Cost>(routeDist)
+                  + costEvaluator.distPenalty(routeDist, vehType.maxDistance)
+                  + costEvaluator.loadPenalty(ls.load(), vehType.capacity)
+                  + vehType.unitDurationCost
+                        * static_cast<Cost>(routeDS.duration())
+                  + costEvaluator.twPenalty(
+                      routeDS.timeWarp(vehType.maxDuration));
+
+            if (in[start] + routeCost < out[pos])
+            {
+                out[pos] = in[start] + routeCost;
+                pred[pos] = start;
+            }
+        }
+    }
+}
+
+void Splitter::layer(std::vector<Cost> const &in,
+                     std::vector<Cost> &out,
+                     std::vector<size_t> &pred) const
+{
+    if (isLinear_)
+        linearLayer(in, out, pred);
+    else
+        bellmanLayer(in, out, pred);
+}
+
+std::vector<pyvrp::Solution::Route>
+Splitter::routes(std::vector<std::vector<size_t>> const &preds) const
+{
+    std::vector<pyvrp::Solution::Route> routes;
+    routes.reserve(preds.size());
+
+    // Walk back from the end of the tour, using the predecessors of the last
+    // layer first. Routes are collected in reverse, and flipped afterwards.
+    size_t end = size();
+    for (auto layer = preds.rbegin(); end != 0; ++layer)
+    {
+        assert(layer != preds.rend());
+
+        auto const start = (*layer)[end];
+        std::vector<size_t> visits(tour.begin() + start + 1,
+                                   tour.begin() + end + 1);
+        routes.emplace_back(data, std::move(visits), 0);
+        end = start;
+    }
+
+    std::reverse(routes.begin(), routes.end());
+    return routes;
+}
+}  // namespace
+
+pyvrp::Solution
+pyvrp::crossover::split(std::vector<size_t> const &tour,
+                        ProblemData const &data,
+                        CostEvaluator const &costEvaluator)
+{
+    if (data.numVehicleTypes() != 1)
+        throw std::invalid_argument("Split requires a single vehicle type.");
+
+    Splitter const splitter(tour, data, costEvaluator);
+    auto const numPositions = splitter.size() + 1;
+
+    if (splitter.size() == 0)
+        return {data, std::vector<Solution::Route>{}};
+
+    // First solve the unlimited fleet problem. The routes then form a single
+    // shortest path, so one layer of potentials suffices.
+    std::vector<Cost> potential(numPositions, UNREACHABLE);
+    std::vector<std::vector<size_t>> preds(1,
+                                           std::vector<size_t>(numPositions));
+    potential[0] = 0;
+    splitter.layer(potential, potential, preds[0]);
+
+    // The predecessors can be followed from the end of the tour in a single
+    // layer. We use the same vector of predecessors for each route, which
+    // Splitter::routes() supports by repeating the layer as needed.
+    size_t numRoutes = 0;
+    for (size_t pos = splitter.size(); pos != 0; pos = preds[0][pos])
+        numRoutes++;
+
+    auto const numAvailable = data.vehicleType(0).numAvailable;
+    if (numRoutes <= numAvailable)
+    {
+        preds.resize(numRoutes, preds[0]);
+        return {data, splitter.routes(preds)};
+    }
+
+    // The unlimited fleet split uses too many vehicles. We now compute the
+    // potentials when using exactly k routes, for k = 1, ..., numAvailable,
+    // and select the best of those.
+    std::vector<std::vector<Cost>> potentials(
+        numAvailable + 1, std::vector<Cost>(numPositions, UNREACHABLE));
+    preds.assign(numAvailable, std::vector<size_t>(numPositions));
+    potentials[0][0] = 0;
+
+    size_t bestNumRoutes = 1;
+    for (size_t k = 1; k <= numAvailable; ++k)
+    {
+        splitter.layer(potentials[k - 1], potentials[k], preds[k - 1]);
+
+        if (potentials[k].back() < potentials[bestNumRoutes].back())
+            bestNumRoutes = k;
+    }
+
+    preds.resize(bestNumRoutes);
+    return {data, splitter.routes(preds)};
+}
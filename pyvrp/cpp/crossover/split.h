@@ -0,0 +1,38 @@
+#ifndef PYVRP_SPLIT_H
+#define PYVRP_SPLIT_H
+
+#include "CostEvaluator.h"
+#include "ProblemData.h"
+#include "Solution.h"
+
+#include <vector>
+
+namespace pyvrp::crossover
+{
+/**
+ * Optimally splits the given giant tour into routes, while respecting the
+ * order in which the tour visits the clients. Route costs are penalised costs,
+ * so the resulting routes may violate capacity, distance, or duration limits
+ * when that is cheaper. At most as many routes are used as there are
+ * vehicles available.
+ *
+ * When route costs only depend on distance and (delivery or pickup) load, the
+ * split is computed in linear time using the algorithm of Vidal (2016). In all
+ * other cases, a quadratic-time Bellman algorithm is used. If the unlimited
+ * fleet solution uses too many vehicles, a limited fleet split is computed
+ * layer by layer, which takes an additional factor equal to the number of
+ * available vehicles.
+ *
+ * @param tour           Giant tour of client indices, without depots.
+ * @param data           The problem data. Must have a single vehicle type.
+ * @param costEvaluator  Cost evaluator to use for penalising route costs.
+ * @return A new solution with the routes of the giant tour.
+ */
+// The above is an internal docstring: split is used by the OX operator on the
+// Python side, and documented there.
+Solution split(std::vector<size_t> const &tour,
+               ProblemData const &data,
+               CostEvaluator const &costEvaluator);
+}  // namespace pyvrp::crossover
+
+#endif  // PYVRP_SPLIT_H
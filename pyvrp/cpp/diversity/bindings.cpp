@@ -1,3 +1,4 @@
+#include "bindings.h"
 #include "diversity.h"
 #include "diversity_docs.h"
 
@@ -5,7 +6,7 @@
 
 namespace py = pybind11;
 
-PYBIND11_MODULE(_diversity, m)
+PYVRP_MODULE(_diversity, m)
 {
     m.def("broken_pairs_distance",
           &pyvrp::diversity::brokenPairsDistance,
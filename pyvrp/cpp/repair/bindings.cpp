@@ -1,3 +1,4 @@
+#include "bindings.h"
 #include "greedy_repair.h"
 #include "nearest_route_insert.h"
 #include "repair_docs.h"
@@ -7,7 +8,7 @@
 
 namespace py = pybind11;
 
-PYBIND11_MODULE(_repair, m)
+PYVRP_MODULE(_repair, m)
 {
     m.def("greedy_repair",
           &pyvrp::repair::greedyRepair,
@@ -49,7 +49,7 @@ pyvrp::repair::exportRoutes(ProblemData const &data, Routes const &routes)
         for (auto *node : route)
             visits.push_back(node->client());
 
-        solRoutes.emplace_back(data, visits, route.vehicleType());
+        solRoutes.emplace_back(data, std::move(visits), route.vehicleType());
     }
 
     return solRoutes;
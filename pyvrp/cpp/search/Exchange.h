@@ -3,9 +3,12 @@
 
 #include "LocalSearchOperator.h"
 #include "Route.h"
+#include "SegmentCache.h"
 #include "primitives.h"
 
 #include <cassert>
+#include <optional>
+#include <vector>
 
 namespace pyvrp::search
 {
@@ -27,6 +30,32 @@ class Exchange : public LocalSearchOperator<Route::Node>
 
     static_assert(N >= M && N > 0, "N < M or N == 0 does not make sense");
 
+    // Relocate moves of the segment at batchU after each of the batchNodes
+    // to another route, as evaluated in bulk by prepare(). Each delta cost is
+    // either the value evaluate() would return, or, when the corresponding
+    // exact flag is not set, an improving partial evaluation that still needs
+    // a full evaluate(). Only used when M == 0.
+    Route::Node *batchU = nullptr;
+    std::vector<Route::Node *> batchNodes;
+    std::vector<Cost> batchDeltas;
+    std::vector<char> batchExact;
+    size_t batchPos = 0;  // position of the most recently looked up node
+
+    // Lanes with the per-candidate data used by the bulk evaluation.
+    std::vector<Cost> laneCost;           // V's route cost terms
+    std::vector<Cost> laneUnitDistCost;   // V's route unit distance cost
+    std::vector<Distance> laneDist;       // proposal distance, excl. U
+    std::vector<Distance> laneMaxDist;    // V's route maximum distance
+    std::vector<Load> laneCapacity;       // V's route capacity
+    std::vector<Load> laneBeforePickup;   // load of V's route up to V
+    std::vector<Load> laneBeforeLoad;
+    std::vector<Load> laneAfterDelivery;  // load of V's route after V
+    std::vector<Load> laneAfterPickup;
+    std::vector<Load> laneAfterLoad;
+
+    // Looks up the bulk evaluation of the pair (U, V), if there is one.
+    std::optional<size_t> findBatch(Route::Node *U, Route::Node *V);
+
     // Tests if the segment starting at node of given length contains the depot
     bool containsDepot(Route::Node *node, size_t segLength) const;
 
@@ -37,20 +66,47 @@ class Exchange : public LocalSearchOperator<Route::Node>
     bool adjacent(Route::Node *U, Route::Node *V) const;
 
     // Special case that's applied when M == 0
+    template <typename USegment>
     Cost evalRelocateMove(Route::Node *U,
                           Route::Node *V,
+                          USegment const &uSegment,
                           CostEvaluator const &costEvaluator) const;
 
     // Applied when M != 0
+    template <typename USegment, typename VSegment>
     Cost evalSwapMove(Route::Node *U,
                       Route::Node *V,
+                      USegment const &uSegment,
+                      VSegment const &vSegment,
                       CostEvaluator const &costEvaluator) const;
 
+    // Evaluates the move. The segment arguments are callables returning the
+    // segment of N clients starting at U, and of M clients starting at V,
+    // respectively. These are only called for segments without a depot.
+    template <typename USegment, typename VSegment>
+    Cost evalMove(Route::Node *U,
+                  Route::Node *V,
+                  USegment const &uSegment,
+                  VSegment const &vSegment,
+                  CostEvaluator const &costEvaluator) const;
+
 public:
     Cost evaluate(Route::Node *U,
                   Route::Node *V,
                   CostEvaluator const &costEvaluator) override;
 
+    Cost evaluateCached(Route::Node *U,
+                        Route::Node *V,
+                        SegmentCache const &uSegments,
+                        SegmentCache const &vSegments,
+                        CostEvaluator const &costEvaluator) override;
+
+    void prepare(Route::Node *U,
+                 std::vector<Route::Node *> const &candidates,
+                 CostEvaluator const &costEvaluator) override;
+
+    void update(Route *U) override;
+
     void apply(Route::Node *U, Route::Node *V) const override;
 };
 
@@ -82,8 +138,10 @@ bool Exchange<N, M>::adjacent(Route::Node *U, Route::Node *V) const
 }
 
 template <size_t N, size_t M>
+template <typename USegment>
 Cost Exchange<N, M>::evalRelocateMove(Route::Node *U,
                                       Route::Node *V,
+                                      USegment const &uSegment,
                                       CostEvaluator const &costEvaluator) const
 {
     assert(U->idx() > 0);
@@ -98,10 +156,8 @@ Cost Exchange<N, M>::evalRelocateMove(Route::Node *U,
         auto const uProposal = uRoute->proposal(uRoute->before(U->idx() - 1),
                                                 uRoute->after(U->idx() + N));
 
-        auto const vProposal
-            = vRoute->proposal(vRoute->before(V->idx()),
-                               uRoute->between(U->idx(), U->idx() + N - 1),
-                               vRoute->after(V->idx() + 1));
+        auto const vProposal = vRoute->proposal(
+            vRoute->before(V->idx()), uSegment(), vRoute->after(V->idx() + 1));
 
         // We're going to incur V's fixed cost if V is currently empty. We lose
         // U's fixed cost if we're moving all of U's clients with this operator.
@@ -119,13 +175,13 @@ Cost Exchange<N, M>::evalRelocateMove(Route::Node *U,
                 deltaCost,
                 route->proposal(route->before(U->idx() - 1),
                                 route->between(U->idx() + N, V->idx()),
-                                route->between(U->idx(), U->idx() + N - 1),
+                                uSegment(),
                                 route->after(V->idx() + 1)));
         else
             costEvaluator.deltaCost(
                 deltaCost,
                 route->proposal(route->before(V->idx()),
-                                route->between(U->idx(), U->idx() + N - 1),
+                                uSegment(),
                                 route->between(V->idx() + 1, U->idx() - 1),
                                 route->after(U->idx() + N)));
     }
@@ -134,8 +190,11 @@ Cost Exchange<N, M>::evalRelocateMove(Route::Node *U,
 }
 
 template <size_t N, size_t M>
+template <typename USegment, typename VSegment>
 Cost Exchange<N, M>::evalSwapMove(Route::Node *U,
                                   Route::Node *V,
+                                  USegment const &uSegment,
+                                  VSegment const &vSegment,
                                   CostEvaluator const &costEvaluator) const
 {
     assert(U->idx() > 0 && V->idx() > 0);
@@ -148,15 +207,13 @@ Cost Exchange<N, M>::evalSwapMove(Route::Node *U,
         auto const *uRoute = U->route();
         auto const *vRoute = V->route();
 
-        auto const uProposal
-            = uRoute->proposal(uRoute->before(U->idx() - 1),
-                               vRoute->between(V->idx(), V->idx() + M - 1),
-                               uRoute->after(U->idx() + N));
+        auto const uProposal = uRoute->proposal(uRoute->before(U->idx() - 1),
+                                                vSegment(),
+                                                uRoute->after(U->idx() + N));
 
-        auto const vProposal
-            = vRoute->proposal(vRoute->before(V->idx() - 1),
-                               uRoute->between(U->idx(), U->idx() + N - 1),
-                               vRoute->after(V->idx() + M));
+        auto const vProposal = vRoute->proposal(vRoute->before(V->idx() - 1),
+                                                uSegment(),
+                                                vRoute->after(V->idx() + M));
 
         costEvaluator.deltaCost(deltaCost, uProposal, vProposal);
     }
@@ -168,17 +225,17 @@ Cost Exchange<N, M>::evalSwapMove(Route::Node *U,
             costEvaluator.deltaCost(
                 deltaCost,
                 route->proposal(route->before(U->idx() - 1),
-                                route->between(V->idx(), V->idx() + M - 1),
+                                vSegment(),
                                 route->between(U->idx() + N, V->idx() - 1),
-                                route->between(U->idx(), U->idx() + N - 1),
+                                uSegment(),
                                 route->after(V->idx() + M)));
         else
             costEvaluator.deltaCost(
                 deltaCost,
                 route->proposal(route->before(V->idx() - 1),
-                                route->between(U->idx(), U->idx() + N - 1),
+                                uSegment(),
                                 route->between(V->idx() + M, U->idx() - 1),
-                                route->between(V->idx(), V->idx() + M - 1),
+                                vSegment(),
                                 route->after(U->idx() + N)));
     }
 
@@ -186,9 +243,12 @@ Cost Exchange<N, M>::evalSwapMove(Route::Node *U,
 }
 
 template <size_t N, size_t M>
-Cost Exchange<N, M>::evaluate(Route::Node *U,
+template <typename USegment, typename VSegment>
+Cost Exchange<N, M>::evalMove(Route::Node *U,
                               Route::Node *V,
-                              CostEvaluator const &costEvaluator)
+                              USegment const &uSegment,
+                              VSegment const &vSegment,
+                              CostEvaluator const &costEvaluator) const
 {
     if (containsDepot(U, N) || overlap(U, V))
         return 0;
@@ -202,7 +262,7 @@ Cost Exchange<N, M>::evaluate(Route::Node *U,
         if (U == n(V))
             return 0;
 
-        return evalRelocateMove(U, V, costEvaluator);
+        return evalRelocateMove(U, V, uSegment, costEvaluator);
     }
     else
     {
@@ -213,10 +273,214 @@ Cost Exchange<N, M>::evaluate(Route::Node *U,
         if (adjacent(U, V))
             return 0;
 
-        return evalSwapMove(U, V, costEvaluator);
+        return evalSwapMove(U, V, uSegment, vSegment, costEvaluator);
     }
 }
 
+template <size_t N, size_t M>
+Cost Exchange<N, M>::evaluate(Route::Node *U,
+                              Route::Node *V,
+                              CostEvaluator const &costEvaluator)
+{
+    auto const uSegment = [U]
+    { return U->route()->between(U->idx(), U->idx() + N - 1); };
+
+    auto const vSegment = [V]
+    { return V->route()->between(V->idx(), V->idx() + M - 1); };
+
+    return evalMove(U, V, uSegment, vSegment, costEvaluator);
+}
+
+template <size_t N, size_t M>
+Cost Exchange<N, M>::evaluateCached(Route::Node *U,
+                                    Route::Node *V,
+                                    SegmentCache const &uSegments,
+                                    SegmentCache const &vSegments,
+                                    CostEvaluator const &costEvaluator)
+{
+    if constexpr (M == 0)
+        if (auto const pos = findBatch(U, V); pos && batchExact[*pos])
+            return batchDeltas[*pos];
+
+    if (uSegments.node() != U || vSegments.node() != V)
+        return evaluate(U, V, costEvaluator);
+
+    auto const uSegment = [&uSegments] { return uSegments.segment(N); };
+    auto const vSegment = [&vSegments] { return vSegments.segment(M); };
+    return evalMove(U, V, uSegment, vSegment, costEvaluator);
+}
+
+template <size_t N, size_t M>
+std::optional<size_t> Exchange<N, M>::findBatch(Route::Node *U,
+                                                Route::Node *V)
+{
+    if (U != batchU)
+        return std::nullopt;
+
+    // Pairs are typically looked up in the order they were prepared, so we
+    // continue searching from the previously found position.
+    for (size_t pos = batchPos; pos != batchNodes.size(); ++pos)
+        if (batchNodes[pos] == V)
+        {
+            batchPos = pos;
+            return pos;
+        }
+
+    return std::nullopt;
+}
+
+template <size_t N, size_t M>
+void Exchange<N, M>::prepare(Route::Node *U,
+                             std::vector<Route::Node *> const &candidates,
+                             CostEvaluator const &costEvaluator)
+{
+    batchU = nullptr;
+    batchNodes.clear();
+    batchPos = 0;
+
+    if constexpr (M == 0)
+    {
+        if (!U->route() || containsDepot(U, N))
+            return;
+
+        auto const *uRoute = U->route();
+        for (auto *V : candidates)  // only moves to other routes are batched;
+            if (V->route() != uRoute)  // these are by far the most common.
+                batchNodes.push_back(V);
+
+        if (batchNodes.empty())
+            return;
+
+        batchU = U;
+        auto const numLanes = batchNodes.size();
+
+        // Terms of the delta cost that only depend on U's route. These are
+        // the same for all candidates. The order of evaluation follows that of
+        // CostEvaluator::deltaCost(), which first adds all distance-related
+        // terms, and then the load penalties.
+        auto const uProposal = uRoute->proposal(uRoute->before(U->idx() - 1),
+                                                uRoute->after(U->idx() + N));
+
+        auto const uDist = uProposal.distanceSegment().distance();
+        Cost uCost = -Cost(uRoute->size() == N) * uRoute->fixedVehicleCost();
+        uCost -= uRoute->distanceCost();
+        uCost -= costEvaluator.distPenalty(uRoute->distance(),
+                                           uRoute->maxDistance());
+        uCost -= costEvaluator.loadPenalty(uRoute->load(), uRoute->capacity());
+        uCost -= uRoute->durationCost();
+        uCost -= costEvaluator.twPenalty(uRoute->timeWarp());
+        uCost += uRoute->unitDistanceCost() * static_cast<Cost>(uDist);
+        uCost += costEvaluator.distPenalty(uDist, uRoute->maxDistance());
+
+        auto const uLoadCost = costEvaluator.loadPenalty(
+            uProposal.loadSegment().load(), uRoute->capacity());
+
+        auto *uLast = N == 1 ? U : (*U->route())[U->idx() + N - 1];
+        DistanceSegment const uSegDist
+            = uRoute->between(U->idx(), U->idx() + N - 1);
+        LoadSegment const uSegLoad
+            = uRoute->between(U->idx(), U->idx() + N - 1);
+
+        // Gather the data of each candidate's route into lanes.
+        laneCost.resize(numLanes);
+        laneUnitDistCost.resize(numLanes);
+        laneDist.resize(numLanes);
+        laneMaxDist.resize(numLanes);
+        laneCapacity.resize(numLanes);
+        laneBeforePickup.resize(numLanes);
+        laneBeforeLoad.resize(numLanes);
+        laneAfterDelivery.resize(numLanes);
+        laneAfterPickup.resize(numLanes);
+        laneAfterLoad.resize(numLanes);
+
+        for (size_t lane = 0; lane != numLanes; ++lane)
+        {
+            auto *V = batchNodes[lane];
+            auto *vRoute = V->route();
+            auto const &distMat = data.distanceMatrix(vRoute->profile());
+
+            Cost vCost = Cost(vRoute->empty()) * vRoute->fixedVehicleCost();
+            vCost -= vRoute->distanceCost();
+            vCost -= costEvaluator.distPenalty(vRoute->distance(),
+                                               vRoute->maxDistance());
+            vCost -= costEvaluator.loadPenalty(vRoute->load(),
+                                               vRoute->capacity());
+            vCost -= vRoute->durationCost();
+            vCost -= costEvaluator.twPenalty(vRoute->timeWarp());
+            laneCost[lane] = vCost;
+
+            DistanceSegment const &before = vRoute->before(V->idx());
+            DistanceSegment const &after = vRoute->after(V->idx() + 1);
+            laneDist[lane] = before.distance() + after.distance()
+                             + distMat(V->client(), U->client())
+                             + distMat(uLast->client(), n(V)->client());
+
+            laneUnitDistCost[lane] = vRoute->unitDistanceCost();
+            laneMaxDist[lane] = vRoute->maxDistance();
+            laneCapacity[lane] = vRoute->capacity();
+
+            LoadSegment const &loadBefore = vRoute->before(V->idx());
+            laneBeforePickup[lane] = loadBefore.pickup();
+            laneBeforeLoad[lane] = loadBefore.load();
+
+            LoadSegment const &loadAfter = vRoute->after(V->idx() + 1);
+            laneAfterDelivery[lane] = loadAfter.delivery();
+            laneAfterPickup[lane] = loadAfter.pickup();
+            laneAfterLoad[lane] = loadAfter.load();
+        }
+
+#ifdef PYVRP_NO_TIME_WINDOWS
+        // Without time windows, the duration terms of the delta cost are all
+        // zero. The distance and load terms then give the exact delta cost.
+        bool constexpr exactAfterLoad = true;
+#else
+        bool constexpr exactAfterLoad = false;
+#endif
+
+        // Evaluate all lanes at once. This loop is free of branches and
+        // function calls other than simple inline arithmetic, so compilers can
+        // vectorise it.
+        batchDeltas.resize(numLanes);
+        batchExact.resize(numLanes);
+
+        auto const uSegDelivery = uSegLoad.delivery();
+        auto const uSegPickup = uSegLoad.pickup();
+        auto const uSegLoadMax = uSegLoad.load();
+        auto const uSegDistance = uSegDist.distance();
+
+        for (size_t lane = 0; lane != numLanes; ++lane)
+        {
+            auto const dist = laneDist[lane] + uSegDistance;
+            auto const distCost = laneCost[lane] + uCost
+                                  + laneUnitDistCost[lane]
+                                        * static_cast<Cost>(dist)
+                                  + costEvaluator.distPenalty(
+                                      dist, laneMaxDist[lane]);
+
+            // Load of the proposal before V -> U -> after V. See LoadSegment
+            // for the details of this merge.
+            auto const pickup = laneBeforePickup[lane] + uSegPickup;
+            auto const load
+                = std::max(laneBeforeLoad[lane] + uSegDelivery,
+                           uSegLoadMax + laneBeforePickup[lane]);
+            auto const newLoad = std::max(load + laneAfterDelivery[lane],
+                                          laneAfterLoad[lane] + pickup);
+
+            auto const loadCost
+                = distCost + uLoadCost
+                  + costEvaluator.loadPenalty(newLoad, laneCapacity[lane]);
+
+            batchDeltas[lane] = distCost >= 0 ? distCost : loadCost;
+            batchExact[lane] = distCost >= 0 || loadCost >= 0 || exactAfterLoad;
+        }
+    }
+}
+
+template <size_t N, size_t M> void Exchange<N, M>::update(Route *)
+{
+    batchU = nullptr;  // routes changed, so the bulk evaluation is outdated.
+}
+
 template <size_t N, size_t M>
 void Exchange<N, M>::apply(Route::Node *U, Route::Node *V) const
 {
@@ -4,11 +4,24 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <numeric>
 
 using pyvrp::Solution;
 using pyvrp::search::LocalSearch;
 
+namespace
+{
+// Hints the processor to bring the given address into cache. This is a no-op
+// on compilers that do not support it.
+inline void prefetch([[maybe_unused]] void const *addr)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(addr);
+#endif
+}
+}  // namespace
+
 Solution LocalSearch::operator()(Solution const &solution,
                                  CostEvaluator const &costEvaluator)
 {
@@ -80,14 +93,44 @@ void LocalSearch::search(CostEvaluator const &costEvaluator)
                 continue;     // nothing left to be done for this client.
 
             // We next apply the regular node operators. These work on pairs
-            // of nodes (U, V), where both U and V are in the solution.
-            for (auto const vClient : neighbours_[uClient])
+            // of nodes (U, V), where both U and V are in the solution. The
+            // candidate V's are gathered first, prefetching the data their
+            // evaluation needs, so that the memory accesses for the next
+            // candidates overlap with evaluating the current one.
+            auto const uNeighbours = activeNeighbours(uClient);
+            for (auto const vClient : uNeighbours)
+                prefetch(&nodes[vClient]);
+
+            candidates.clear();
+            eligible.clear();
+            for (auto const vClient : uNeighbours)
             {
                 auto *V = &nodes[vClient];
 
-                if (!V->route())
-                    continue;
+                if (!V->route())  // node operators do not insert clients, so
+                    continue;     // V will not be in the solution later on.
+
+                auto const *route = V->route();
+                route->prefetch(V->idx());
+
+                auto const &distMat = data.distanceMatrix(route->profile());
+                prefetch(&distMat(uClient, vClient));
+                prefetch(&distMat(vClient, uClient));
 
+                candidates.push_back(V);
+                if (lastModified[U->route()->idx()] > lastTestedNode
+                    || lastModified[route->idx()] > lastTestedNode)
+                    eligible.push_back(V);
+            }
+
+            // Let the node operators evaluate moves of U to all currently
+            // eligible candidates in bulk, if they support doing so.
+            if (!eligible.empty())
+                for (auto const op : nodeOpOrder)
+                    nodeOps[op]->prepare(U, eligible, costEvaluator);
+
+            for (auto *V : candidates)
+            {
                 if (lastModified[U->route()->idx()] > lastTestedNode
                     || lastModified[V->route()->idx()] > lastTestedNode)
                 {
@@ -157,7 +200,19 @@ void LocalSearch::intensify(CostEvaluator const &costEvaluator,
 void LocalSearch::shuffle(RandomNumberGenerator &rng)
 {
     std::shuffle(orderNodes.begin(), orderNodes.end(), rng);
-    std::shuffle(nodeOps.begin(), nodeOps.end(), rng);
+
+    if (adaptive)
+        selector.select(nodeOpOrder, rng);
+    else
+    {
+        if (nodeOpOrder.size() != nodeOps.size())  // some were disabled
+        {
+            nodeOpOrder.resize(nodeOps.size());
+            std::iota(nodeOpOrder.begin(), nodeOpOrder.end(), 0);
+        }
+
+        std::shuffle(nodeOpOrder.begin(), nodeOpOrder.end(), rng);
+    }
 
     std::shuffle(orderRoutes.begin(), orderRoutes.end(), rng);
     std::shuffle(routeOps.begin(), routeOps.end(), rng);
@@ -167,11 +222,39 @@ bool LocalSearch::applyNodeOps(Route::Node *U,
                                Route::Node *V,
                                CostEvaluator const &costEvaluator)
 {
-    for (auto *nodeOp : nodeOps)
+    // U's segments remain valid across the neighbours V, until a move is
+    // applied. V's segments are only shared between the operators for this
+    // pair. The operators are still evaluated in the (shuffled) order, and
+    // the first improving move is applied.
+    if (uSegments.node() != U)
+        uSegments.reset(U);
+
+    vSegments.reset(V);
+
+    for (auto const op : nodeOpOrder)
     {
-        auto const deltaCost = nodeOp->evaluate(U, V, costEvaluator);
+        auto *nodeOp = nodeOps[op];
+
+        Cost deltaCost;
+        if (adaptive && selector.evaluated(op))
+        {
+            auto const start = std::chrono::steady_clock::now();
+            deltaCost = nodeOp->evaluateCached(
+                U, V, uSegments, vSegments, costEvaluator);
+
+            std::chrono::duration<double> const elapsed
+                = std::chrono::steady_clock::now() - start;
+            selector.recordTime(op, elapsed.count());
+        }
+        else
+            deltaCost = nodeOp->evaluateCached(
+                U, V, uSegments, vSegments, costEvaluator);
+
         if (deltaCost < 0)
         {
+            if (adaptive)
+                selector.recordGain(op, -deltaCost);
+
             auto *rU = U->route();  // copy these because the operator can
             auto *rV = V->route();  // modify the nodes' route membership
 
@@ -332,7 +415,7 @@ void LocalSearch::insert(Route::Node *U,
     Route::Node *UAfter = routes[0][0];
     Cost bestCost = insertCost(U, UAfter, data, costEvaluator);
 
-    for (auto const vClient : neighbours_[U->client()])
+    for (auto const vClient : activeNeighbours(U->client()))
     {
         auto *V = &nodes[vClient];
 
@@ -359,12 +442,18 @@ void LocalSearch::update(Route *U, Route *V)
     numMoves++;
     searchCompleted = false;
 
+    uSegments.reset();  // cached segments are no longer valid after
+    vSegments.reset();  // a move modified the routes
+
     U->update();
     lastModified[U->idx()] = numMoves;
 
     for (auto *op : routeOps)  // this is used by some route operators
         op->update(U);         // to keep caches in sync.
 
+    for (auto *op : nodeOps)  // and by node operators that evaluate moves
+        op->update(U);        // in bulk.
+
     if (U != V)
     {
         V->update();
@@ -372,15 +461,27 @@ void LocalSearch::update(Route *U, Route *V)
 
         for (auto *op : routeOps)  // this is used by some route operators
             op->update(V);         // to keep caches in sync.
+
+        for (auto *op : nodeOps)
+            op->update(V);
     }
 }
 
 void LocalSearch::loadSolution(Solution const &solution)
 {
-    // First empty all routes.
+    // First empty all routes, and clear any segments cached or moves evaluated
+    // for those.
     for (auto &route : routes)
+    {
         route.clear();
 
+        for (auto *nodeOp : nodeOps)
+            nodeOp->update(&route);
+    }
+
+    uSegments.reset();
+    vSegments.reset();
+
     // Determine offsets for vehicle types.
     std::vector<size_t> vehicleOffset(data.numVehicleTypes(), 0);
     for (size_t vehType = 1; vehType < data.numVehicleTypes(); vehType++)
@@ -425,16 +526,36 @@ Solution LocalSearch::exportSolution() const
         for (auto *node : route)
             visits.push_back(node->client());
 
-        solRoutes.emplace_back(data, visits, route.vehicleType());
+        solRoutes.emplace_back(data, std::move(visits), route.vehicleType());
     }
 
-    return {data, solRoutes};
+    return {data, std::move(solRoutes)};
 }
 
-void LocalSearch::addNodeOperator(NodeOp &op) { nodeOps.emplace_back(&op); }
+void LocalSearch::addNodeOperator(NodeOp &op)
+{
+    nodeOpOrder.push_back(nodeOps.size());
+    nodeOps.emplace_back(&op);
+    selector.add();
+}
 
 void LocalSearch::addRouteOperator(RouteOp &op) { routeOps.emplace_back(&op); }
 
+void LocalSearch::setAdaptive(bool adaptive)
+{
+    this->adaptive = adaptive;
+
+    // All node operators are applied again until the next shuffle() call
+    // selects them adaptively.
+    nodeOpOrder.resize(nodeOps.size());
+    std::iota(nodeOpOrder.begin(), nodeOpOrder.end(), 0);
+}
+
+std::vector<double> LocalSearch::nodeOperatorYields() const
+{
+    return selector.yields();
+}
+
 void LocalSearch::setNeighbours(Neighbours neighbours)
 {
     if (neighbours.size() != data.numLocations())
@@ -460,6 +581,28 @@ void LocalSearch::setNeighbours(Neighbours neighbours)
     neighbours_ = neighbours;
 }
 
+void LocalSearch::setNumActiveNeighbours(size_t numActiveNeighbours)
+{
+    numActiveNeighbours_ = numActiveNeighbours;
+}
+
+size_t LocalSearch::numActiveNeighbours() const
+{
+    // The active prefix is bounded by the longest neighbour list.
+    size_t maxSize = 0;
+    for (auto const &clientNeighbours : neighbours_)
+        maxSize = std::max(maxSize, clientNeighbours.size());
+
+    return std::min(numActiveNeighbours_, maxSize);
+}
+
+std::span<size_t const> LocalSearch::activeNeighbours(size_t client) const
+{
+    auto const &clientNeighbours = neighbours_[client];
+    auto const size = std::min(numActiveNeighbours_, clientNeighbours.size());
+    return {clientNeighbours.data(), size};
+}
+
 LocalSearch::Neighbours const &LocalSearch::neighbours() const
 {
     return neighbours_;
@@ -470,7 +613,9 @@ LocalSearch::LocalSearch(ProblemData const &data, Neighbours neighbours)
       neighbours_(data.numLocations()),
       orderNodes(data.numClients()),
       orderRoutes(data.numVehicles()),
-      lastModified(data.numVehicles(), -1)
+      lastModified(data.numVehicles(), -1),
+      uSegments(data),
+      vSegments(data)
 {
     setNeighbours(neighbours);
 
@@ -3,12 +3,16 @@
 
 #include "CostEvaluator.h"
 #include "LocalSearchOperator.h"
+#include "OperatorSelector.h"
 #include "ProblemData.h"
 #include "RandomNumberGenerator.h"
 #include "Route.h"
+#include "SegmentCache.h"
 #include "Solution.h"
 
 #include <functional>
+#include <limits>
+#include <span>
 #include <stdexcept>
 #include <vector>
 
@@ -26,17 +30,44 @@ class LocalSearch
     // numLocations, but nothing is stored for the depots!)
     Neighbours neighbours_;
 
+    // Only this many of each client's nearest neighbours are considered. The
+    // neighbour lists are sorted by proximity, so this prefix contains the
+    // nearest neighbours.
+    size_t numActiveNeighbours_ = std::numeric_limits<size_t>::max();
+
+    // Returns the currently active prefix of the given client's neighbours.
+    std::span<size_t const> activeNeighbours(size_t client) const;
+
     std::vector<size_t> orderNodes;   // node order used by LS::search
     std::vector<size_t> orderRoutes;  // route order used by LS::intensify
 
     std::vector<int> lastModified;  // tracks when routes were last modified
 
+    // Buffer of U's neighbours that are in the solution, as gathered for the
+    // node pair evaluations of LS::search.
+    std::vector<Route::Node *> candidates;
+    std::vector<Route::Node *> eligible;  // candidates with modified routes
+
     std::vector<Route::Node> nodes;
     std::vector<Route> routes;
 
     std::vector<NodeOp *> nodeOps;
     std::vector<RouteOp *> routeOps;
 
+    // Indices of the node operators to apply, in the order they are applied.
+    // Without adaptive operator selection, this is a shuffled order of all
+    // node operators.
+    std::vector<size_t> nodeOpOrder;
+
+    bool adaptive = false;  // whether node operators are selected adaptively
+    OperatorSelector selector;
+
+    // Segments starting at the U and V nodes of the node pair that is being
+    // evaluated. These are shared by all node operators, and cleared whenever
+    // a move is applied.
+    SegmentCache uSegments;
+    SegmentCache vSegments;
+
     int numMoves = 0;              // Operator counter
     bool searchCompleted = false;  // No further improving move found?
 
@@ -91,6 +122,33 @@ public:
      */
     void addRouteOperator(RouteOp &op);
 
+    /**
+     * Enables or disables adaptive selection of the node operators. When
+     * enabled, ``shuffle()`` orders the node operators by their measured
+     * yield, and temporarily disables operators with low yield.
+     */
+    void setAdaptive(bool adaptive);
+
+    /**
+     * @return The measured yield of each node operator, in the order they were
+     *         added. Yields are only measured with adaptive selection.
+     */
+    std::vector<double> nodeOperatorYields() const;
+
+    /**
+     * Sets the number of nearest neighbours of each client that are considered
+     * by the search. Neighbour lists are assumed to be sorted by proximity, so
+     * this selects a prefix of each client's neighbours. The neighbourhood
+     * thus can grow and shrink without being recomputed.
+     */
+    void setNumActiveNeighbours(size_t numActiveNeighbours);
+
+    /**
+     * @return The number of nearest neighbours of each client that are
+     *         considered by the search.
+     */
+    size_t numActiveNeighbours() const;
+
     /**
      * Set neighbourhood structure to use by the local search. For each client,
      * the neighbourhood structure is a vector of nearby clients. Depots have
@@ -127,7 +185,9 @@ public:
 
     /**
      * Shuffles the order in which the node and route pairs are evaluated, and
-     * the order in which node and route operators are applied.
+     * the order in which node and route operators are applied. With adaptive
+     * operator selection, node operators are instead selected and ordered by
+     * their yield.
      */
     void shuffle(RandomNumberGenerator &rng);
 
@@ -5,8 +5,11 @@
 #include "Measure.h"
 #include "ProblemData.h"
 #include "Route.h"
+#include "SegmentCache.h"
 #include "Solution.h"
 
+#include <vector>
+
 namespace pyvrp::search
 {
 template <typename Arg> class LocalSearchOperatorBase
@@ -55,6 +58,42 @@ class LocalSearchOperator<Route::Node>
     : public LocalSearchOperatorBase<Route::Node>
 {
     using LocalSearchOperatorBase::LocalSearchOperatorBase;
+
+public:
+    /**
+     * Determines the cost delta of applying this operator to the arguments,
+     * with the same contract as <code>evaluate()</code>. The given caches hold
+     * the segments starting at U and V, and are shared by all node operators
+     * evaluating this pair. Operators may read those segments rather than
+     * computing them from the routes; by default, the caches are not used.
+     */
+    virtual Cost evaluateCached(Route::Node *U,
+                                Route::Node *V,
+                                [[maybe_unused]] SegmentCache const &uSegments,
+                                [[maybe_unused]] SegmentCache const &vSegments,
+                                CostEvaluator const &costEvaluator)
+    {
+        return evaluate(U, V, costEvaluator);
+    }
+
+    /**
+     * Called before evaluating the node pairs (U, V) for the given candidate
+     * V's. This can be used to evaluate those pairs in bulk; the results may
+     * be used by <code>evaluateCached()</code> until the next call to this
+     * method or to <code>update()</code>. By default, this does nothing.
+     */
+    virtual void prepare([[maybe_unused]] Route::Node *U,
+                         [[maybe_unused]] std::vector<Route::Node *> const
+                             &candidates,
+                         [[maybe_unused]] CostEvaluator const &costEvaluator)
+    {
+    }
+
+    /**
+     * Called when a route has been changed. Can be used to invalidate any
+     * state prepared for the current node pairs.
+     */
+    virtual void update([[maybe_unused]] Route *U) {};
 };
 
 template <>  // specialisation for route operators
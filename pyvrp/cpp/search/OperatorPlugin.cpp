@@ -0,0 +1,177 @@
+#include "OperatorPlugin.h"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+using pyvrp::search::OperatorPlugin;
+using pyvrp::search::OperatorRegistry;
+using pyvrp::search::PluginAbi;
+
+namespace
+{
+using AbiFunc = PluginAbi (*)();
+using RegisterFunc = void (*)(OperatorRegistry &);
+
+// Collects the registered operators on behalf of the plugin.
+class Collector : public OperatorRegistry
+{
+public:
+    std::vector<std::pair<std::string, NodeOperatorFactory>> nodeOps;
+    std::vector<std::pair<std::string, RouteOperatorFactory>> routeOps;
+
+    void addNodeOperator(char const *name, NodeOperatorFactory factory) override
+    {
+        nodeOps.emplace_back(name, factory);
+    }
+
+    void addRouteOperator(char const *name,
+                          RouteOperatorFactory factory) override
+    {
+        routeOps.emplace_back(name, factory);
+    }
+};
+
+void *openLibrary(std::string const &path)
+{
+#if defined(_WIN32)
+    return static_cast<void *>(LoadLibraryA(path.c_str()));
+#else
+    return dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+#endif
+}
+
+void closeLibrary(void *handle)
+{
+#if defined(_WIN32)
+    FreeLibrary(static_cast<HMODULE>(handle));
+#else
+    dlclose(handle);
+#endif
+}
+
+void *findSymbol(void *handle, char const *name)
+{
+#if defined(_WIN32)
+    auto *symbol = GetProcAddress(static_cast<HMODULE>(handle), name);
+    return reinterpret_cast<void *>(symbol);
+#else
+    return dlsym(handle, name);
+#endif
+}
+
+std::string lastError()
+{
+#if defined(_WIN32)
+    return "error code " + std::to_string(GetLastError());
+#else
+    auto const *error = dlerror();
+    return error ? error : "unknown error";
+#endif
+}
+
+std::string describe(PluginAbi const &abi)
+{
+    std::ostringstream out;
+    out << "version " << abi.version << ", "
+        << (abi.timeWindows ? "with" : "without") << " time windows, "
+        << "node size " << abi.nodeSize << ", "
+        << "route size " << abi.routeSize << ", "
+        << "data size " << abi.dataSize;
+    return out.str();
+}
+
+template <typename Factories>
+auto findFactory(Factories const &factories, std::string const &name)
+{
+    auto const pred = [&](auto const &item) { return item.first == name; };
+    auto const it = std::find_if(factories.begin(), factories.end(), pred);
+
+    if (it == factories.end())
+        throw std::invalid_argument("Plugin has no operator named '" + name
+                                    + "'.");
+
+    return it->second;
+}
+}  // namespace
+
+OperatorPlugin::OperatorPlugin(std::string path) : path_(std::move(path))
+{
+    handle = openLibrary(path_);
+    if (!handle)
+        throw std::runtime_error("Could not load plugin " + path_ + ": "
+                                 + lastError());
+
+    auto *abiSymbol = findSymbol(handle, PYVRP_PLUGIN_ABI_SYMBOL);
+    auto *registerSymbol = findSymbol(handle, PYVRP_PLUGIN_REGISTER_SYMBOL);
+
+    if (!abiSymbol || !registerSymbol)
+    {
+        closeLibrary(handle);
+        throw std::runtime_error(path_ + " is not an operator plugin.");
+    }
+
+    // The plugin's interface must exactly match ours. Otherwise operators
+    // would read and write routes and nodes using a different layout.
+    auto const abi = reinterpret_cast<AbiFunc>(abiSymbol)();
+    if (abi != PluginAbi::current())
+    {
+        closeLibrary(handle);
+
+        std::ostringstream msg;
+        msg << "Plugin " << path_ << " is incompatible: it was compiled for "
+            << describe(abi) << ", but this extension requires "
+            << describe(PluginAbi::current()) << ".";
+        throw std::invalid_argument(msg.str());
+    }
+
+    Collector collector;
+    reinterpret_cast<RegisterFunc>(registerSymbol)(collector);
+
+    nodeOps = std::move(collector.nodeOps);
+    routeOps = std::move(collector.routeOps);
+}
+
+OperatorPlugin::~OperatorPlugin() { closeLibrary(handle); }
+
+std::string const &OperatorPlugin::path() const { return path_; }
+
+std::vector<std::string> OperatorPlugin::nodeOperators() const
+{
+    std::vector<std::string> names;
+    for (auto const &[name, factory] : nodeOps)
+        names.push_back(name);
+
+    return names;
+}
+
+std::vector<std::string> OperatorPlugin::routeOperators() const
+{
+    std::vector<std::string> names;
+    for (auto const &[name, factory] : routeOps)
+        names.push_back(name);
+
+    return names;
+}
+
+std::unique_ptr<OperatorPlugin::NodeOp>
+OperatorPlugin::nodeOperator(std::string const &name,
+                             ProblemData const &data) const
+{
+    auto const factory = findFactory(nodeOps, name);
+    return std::unique_ptr<NodeOp>(factory(data));
+}
+
+std::unique_ptr<OperatorPlugin::RouteOp>
+OperatorPlugin::routeOperator(std::string const &name,
+                              ProblemData const &data) const
+{
+    auto const factory = findFactory(routeOps, name);
+    return std::unique_ptr<RouteOp>(factory(data));
+}
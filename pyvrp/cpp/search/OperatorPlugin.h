@@ -0,0 +1,97 @@
+#ifndef PYVRP_SEARCH_OPERATORPLUGIN_H
+#define PYVRP_SEARCH_OPERATORPLUGIN_H
+
+#include "LocalSearchOperator.h"
+#include "OperatorRegistry.h"
+#include "ProblemData.h"
+#include "Route.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pyvrp::search
+{
+/**
+ * OperatorPlugin(path: str)
+ *
+ * Loads native node and route operators from a shared library that is
+ * compiled separately, against the plugin SDK in
+ * ``search/OperatorRegistry.h``. The operators created by a plugin run at the
+ * same speed as PyVRP's own operators, and can be added to the local search
+ * like any other operator.
+ *
+ * .. note::
+ *
+ *    The plugin must be compiled against the headers of this version of
+ *    PyVRP, with the same compiler and flags. Loading raises when the plugin
+ *    does not match this extension.
+ *
+ * Parameters
+ * ----------
+ * path
+ *     Location of the shared library to load.
+ *
+ * Raises
+ * ------
+ * RuntimeError
+ *     When the shared library cannot be loaded, or does not export the plugin
+ *     entry points.
+ * ValueError
+ *     When the plugin was compiled against an incompatible interface.
+ */
+class OperatorPlugin
+{
+    using NodeOp = LocalSearchOperator<Route::Node>;
+    using RouteOp = LocalSearchOperator<Route>;
+
+    void *handle = nullptr;
+    std::string path_;
+
+    std::vector<std::pair<std::string, OperatorRegistry::NodeOperatorFactory>>
+        nodeOps;
+
+    std::vector<std::pair<std::string, OperatorRegistry::RouteOperatorFactory>>
+        routeOps;
+
+public:
+    explicit OperatorPlugin(std::string path);
+
+    // The library is unloaded when the plugin is destroyed, so the plugin
+    // must outlive all operators it created.
+    ~OperatorPlugin();
+
+    OperatorPlugin(OperatorPlugin const &) = delete;
+    OperatorPlugin &operator=(OperatorPlugin const &) = delete;
+
+    /**
+     * Returns the location of the loaded shared library.
+     */
+    [[nodiscard]] std::string const &path() const;
+
+    /**
+     * Returns the names of the node operators this plugin provides.
+     */
+    [[nodiscard]] std::vector<std::string> nodeOperators() const;
+
+    /**
+     * Returns the names of the route operators this plugin provides.
+     */
+    [[nodiscard]] std::vector<std::string> routeOperators() const;
+
+    /**
+     * Creates a new instance of the node operator with the given name.
+     */
+    [[nodiscard]] std::unique_ptr<NodeOp>
+    nodeOperator(std::string const &name, ProblemData const &data) const;
+
+    /**
+     * Creates a new instance of the route operator with the given name.
+     */
+    [[nodiscard]] std::unique_ptr<RouteOp>
+    routeOperator(std::string const &name, ProblemData const &data) const;
+};
+}  // namespace pyvrp::search
+
+#endif  // PYVRP_SEARCH_OPERATORPLUGIN_H
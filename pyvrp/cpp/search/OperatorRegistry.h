@@ -0,0 +1,153 @@
+#ifndef PYVRP_SEARCH_OPERATORREGISTRY_H
+#define PYVRP_SEARCH_OPERATORREGISTRY_H
+
+#include "LocalSearchOperator.h"
+#include "ProblemData.h"
+#include "Route.h"
+
+#include <cstdint>
+
+// This header is the SDK for operator plugins: shared libraries that provide
+// native node and route operators, and that are compiled separately from
+// PyVRP. A plugin implements its operators by deriving from
+// LocalSearchOperator, exactly like PyVRP's own operators do, and registers
+// them using the PYVRP_REGISTER_OPERATORS macro:
+//
+// <pre>
+// #include "search/OperatorRegistry.h"
+//
+// class MyMove : public pyvrp::search::LocalSearchOperator<Route::Node>
+// {
+//     // ...
+// };
+//
+// PYVRP_REGISTER_OPERATORS(registry)
+// {
+//     registry.addNodeOperator<MyMove>("MyMove");
+// }
+// </pre>
+//
+// Operators may use everything that is defined in PyVRP's headers. Functions
+// that are defined in PyVRP's source files (for example, those in Route.cpp
+// or primitives.cpp) must be compiled into the plugin as well. The plugin
+// must be compiled with the same compiler and flags as PyVRP itself. In
+// particular, PYVRP_NO_TIME_WINDOWS must be defined for plugins that are used
+// with PyVRP's CVRP build.
+
+#if defined(_WIN32)
+#define PYVRP_PLUGIN_EXPORT extern "C" __declspec(dllexport)
+#else
+#define PYVRP_PLUGIN_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+namespace pyvrp::search
+{
+/**
+ * Describes the interface a plugin was compiled against. A plugin can only be
+ * loaded when its interface exactly matches that of the loading extension.
+ */
+struct PluginAbi
+{
+    // Incremented whenever the operator interface changes in a way that is
+    // not compatible with previously compiled plugins.
+    static constexpr uint32_t VERSION = 1;
+
+    uint32_t version;
+    uint32_t timeWindows;  // whether time windows are compiled in
+    uint32_t nodeSize;     // sizeof(Route::Node)
+    uint32_t routeSize;    // sizeof(Route)
+    uint32_t dataSize;     // sizeof(ProblemData)
+
+    bool operator==(PluginAbi const &other) const = default;
+
+    /**
+     * Returns the interface of the code that is currently being compiled.
+     */
+    static constexpr PluginAbi current()
+    {
+#ifdef PYVRP_NO_TIME_WINDOWS
+        uint32_t const timeWindows = 0;
+#else
+        uint32_t const timeWindows = 1;
+#endif
+        return {VERSION,
+                timeWindows,
+                sizeof(Route::Node),
+                sizeof(Route),
+                sizeof(ProblemData)};
+    }
+};
+
+/**
+ * Collects the operators a plugin provides. Registration happens through
+ * virtual calls, so that all bookkeeping is done by the loading extension
+ * rather than by the plugin.
+ */
+class OperatorRegistry
+{
+public:
+    using NodeOperatorFactory
+        = LocalSearchOperator<Route::Node> *(*)(ProblemData const &);
+
+    using RouteOperatorFactory
+        = LocalSearchOperator<Route> *(*)(ProblemData const &);
+
+    virtual ~OperatorRegistry() = default;
+
+    /**
+     * Registers a node operator under the given name. The factory returns a
+     * new operator for the given data, allocated using <code>new</code>.
+     */
+    virtual void addNodeOperator(char const *name, NodeOperatorFactory factory)
+        = 0;
+
+    /**
+     * Registers a route operator under the given name. The factory returns a
+     * new operator for the given data, allocated using <code>new</code>.
+     */
+    virtual void addRouteOperator(char const *name,
+                                  RouteOperatorFactory factory)
+        = 0;
+
+    /**
+     * Registers the node operator type Op under the given name. Op must be
+     * constructible from a ProblemData reference.
+     */
+    template <typename Op> void addNodeOperator(char const *name)
+    {
+        addNodeOperator(name,
+                        [](ProblemData const &data)
+                            -> LocalSearchOperator<Route::Node> *
+                        { return new Op(data); });
+    }
+
+    /**
+     * Registers the route operator type Op under the given name. Op must be
+     * constructible from a ProblemData reference.
+     */
+    template <typename Op> void addRouteOperator(char const *name)
+    {
+        addRouteOperator(name,
+                         [](ProblemData const &data)
+                             -> LocalSearchOperator<Route> *
+                         { return new Op(data); });
+    }
+};
+}  // namespace pyvrp::search
+
+// Names of the entry points every plugin exports.
+#define PYVRP_PLUGIN_ABI_SYMBOL "pyvrp_plugin_abi"
+#define PYVRP_PLUGIN_REGISTER_SYMBOL "pyvrp_register_operators"
+
+// Defines the plugin's entry points. Must be followed by the body of the
+// registration function, which receives the registry under the given name.
+#define PYVRP_REGISTER_OPERATORS(registry)                                     \
+    PYVRP_PLUGIN_EXPORT pyvrp::search::PluginAbi pyvrp_plugin_abi()            \
+    {                                                                          \
+        return pyvrp::search::PluginAbi::current();                            \
+    }                                                                          \
+                                                                               \
+    PYVRP_PLUGIN_EXPORT void pyvrp_register_operators(                         \
+        pyvrp::search::OperatorRegistry &registry)
+
+#endif  // PYVRP_SEARCH_OPERATORREGISTRY_H
@@ -0,0 +1,98 @@
+#include "OperatorSelector.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+using pyvrp::search::OperatorSelector;
+
+OperatorSelector::OperatorSelector(double decay, double minProbability)
+    : decay_(decay), minProbability_(minProbability)
+{
+    if (decay < 0 || decay > 1)
+        throw std::invalid_argument("decay must be in [0, 1].");
+
+    if (minProbability < 0 || minProbability > 1)
+        throw std::invalid_argument("min_probability must be in [0, 1].");
+}
+
+void OperatorSelector::add() { stats.emplace_back(); }
+
+void OperatorSelector::recordTime(size_t op, double seconds)
+{
+    stats[op].sampledTime += seconds;
+    stats[op].numSamples += 1;
+}
+
+std::vector<double> OperatorSelector::yields() const
+{
+    std::vector<double> yields;
+    yields.reserve(stats.size());
+
+    for (auto const &opStats : stats)
+    {
+        if (opStats.numSamples == 0)
+        {
+            yields.push_back(std::numeric_limits<double>::infinity());
+            continue;
+        }
+
+        // The time spent evaluating this operator is estimated from the
+        // average time of the sampled evaluations.
+        auto const avgTime = opStats.sampledTime / opStats.numSamples;
+        auto const spent = std::max(opStats.numEvals * avgTime, 1e-12);
+        yields.push_back(opStats.gain / spent);
+    }
+
+    return yields;
+}
+
+void OperatorSelector::select(std::vector<size_t> &order,
+                              RandomNumberGenerator &rng)
+{
+    auto const opYields = yields();
+
+    for (auto &opStats : stats)
+    {
+        opStats.numEvals *= decay_;
+        opStats.gain *= decay_;
+        opStats.sampledTime *= decay_;
+        opStats.numSamples *= decay_;
+    }
+
+    order.resize(stats.size());
+    std::iota(order.begin(), order.end(), 0);
+    if (order.empty())
+        return;
+
+    // Operators with equal yield (e.g., those that have not been timed yet)
+    // are applied in random order.
+    std::shuffle(order.begin(), order.end(), rng);
+    std::stable_sort(order.begin(),
+                     order.end(),
+                     [&](auto op1, auto op2)
+                     { return opYields[op1] > opYields[op2]; });
+
+    // The best operator is always applied. The others are applied with a
+    // probability proportional to their yield relative to the best operator.
+    // When no operator has improved anything recently, all are applied.
+    auto const best = opYields[order.front()];
+    auto const isSelected = [&](auto op)
+    {
+        if (op == order.front() || best <= 0 || opYields[op] == best)
+            return true;
+
+        auto const prob = std::max(opYields[op] / best, minProbability_);
+        return rng.rand() < prob;
+    };
+
+    std::vector<size_t> selected;
+    std::copy_if(order.begin(),
+                 order.end(),
+                 std::back_inserter(selected),
+                 isSelected);
+
+    order = std::move(selected);
+}
@@ -0,0 +1,99 @@
+#ifndef PYVRP_SEARCH_OPERATORSELECTOR_H
+#define PYVRP_SEARCH_OPERATORSELECTOR_H
+
+#include "Measure.h"
+#include "RandomNumberGenerator.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace pyvrp::search
+{
+/**
+ * Adaptive selection of the node operators used by the local search. This
+ * tracks the yield of each operator: the improvement it finds per unit of
+ * evaluation time. Operators with a high yield are applied first, and
+ * operators with a low yield are temporarily disabled with a probability that
+ * increases as their yield decreases. Statistics decay over time, so that the
+ * selection adapts to the current stage of the search.
+ *
+ * Evaluation time is estimated by timing a sample of each operator's
+ * evaluations, since timing every single evaluation would take about as long
+ * as the evaluations themselves.
+ */
+class OperatorSelector
+{
+    struct Stats
+    {
+        size_t numCalls = 0;       // total evaluations, used for sampling
+        double numEvals = 0;       // (decayed) number of evaluations
+        double gain = 0;           // (decayed) total improvement
+        double sampledTime = 0;    // (decayed) time of sampled evaluations
+        double numSamples = 0;     // (decayed) number of sampled evaluations
+    };
+
+    std::vector<Stats> stats;
+    double decay_;
+    double minProbability_;
+
+public:
+    // One in every SAMPLE_INTERVAL evaluations of an operator is timed.
+    static constexpr size_t SAMPLE_INTERVAL = 64;
+
+    /**
+     * Creates an operator selector. Each call to select() multiplies all
+     * statistics by the given decay factor. Operators are enabled with at
+     * least the given minimum probability.
+     */
+    OperatorSelector(double decay = 0.95, double minProbability = 0.1);
+
+    /**
+     * Starts tracking statistics for a new operator.
+     */
+    void add();
+
+    /**
+     * Registers an evaluation of the given operator, and returns whether that
+     * evaluation should be timed and passed to recordTime().
+     */
+    inline bool evaluated(size_t op);
+
+    /**
+     * Registers the duration (in seconds) of a sampled evaluation.
+     */
+    void recordTime(size_t op, double seconds);
+
+    /**
+     * Registers an improving move of the given operator.
+     */
+    inline void recordGain(size_t op, Cost improvement);
+
+    /**
+     * Returns the current yield of each operator, as the improvement per
+     * second spent evaluating the operator. Operators that have not yet been
+     * timed have infinite yield.
+     */
+    [[nodiscard]] std::vector<double> yields() const;
+
+    /**
+     * Decays the statistics, and selects the operators to apply, in the order
+     * they should be applied. The operator with the highest yield is always
+     * selected. The selected operator indices are written to ``order``.
+     */
+    void select(std::vector<size_t> &order, RandomNumberGenerator &rng);
+};
+
+bool OperatorSelector::evaluated(size_t op)
+{
+    auto &opStats = stats[op];
+    opStats.numEvals += 1;
+    return opStats.numCalls++ % SAMPLE_INTERVAL == 0;
+}
+
+void OperatorSelector::recordGain(size_t op, Cost improvement)
+{
+    stats[op].gain += static_cast<double>(improvement);
+}
+}  // namespace pyvrp::search
+
+#endif  // PYVRP_SEARCH_OPERATORSELECTOR_H
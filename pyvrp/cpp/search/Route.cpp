@@ -1,19 +1,32 @@
 #include "Route.h"
 
 #include <cmath>
+#include <limits>
 #include <numbers>
 #include <ostream>
 #include <utility>
 
 using pyvrp::search::Route;
 
-Route::Node::Node(size_t loc) : loc_(loc), idx_(0), route_(nullptr) {}
+Route::Node::Node(size_t loc)
+    : loc_(static_cast<uint32_t>(loc)), idx_(0), route_(nullptr)
+{
+    assert(loc <= std::numeric_limits<uint32_t>::max());
+}
 
 Route::Route(ProblemData const &data, size_t idx, size_t vehicleType)
     : data(data),
       vehicleType_(data.vehicleType(vehicleType)),
       vehTypeIdx_(vehicleType),
       idx_(idx),
+      summary({0,
+               vehicleType_.unitDistanceCost,
+               vehicleType_.maxDistance,
+               0,
+               vehicleType_.capacity,
+               0,
+               vehicleType_.unitDurationCost,
+               0}),
       startDepot(vehicleType_.depot),
       endDepot(vehicleType_.depot)
 {
@@ -107,6 +120,8 @@ void Route::clear()
     durAfter = durAt;
     durBefore = durAt;
 
+    updateSummary();
+
 #ifndef NDEBUG
     dirty = false;
 #endif
@@ -116,13 +131,14 @@ void Route::insert(size_t idx, Node *node)
 {
     assert(0 < idx && idx < nodes.size());
     assert(!node->route());  // must previously have been unassigned
+    assert(nodes.size() <= std::numeric_limits<uint32_t>::max());
 
-    node->idx_ = idx;
+    node->idx_ = static_cast<uint32_t>(idx);
     node->route_ = this;
     nodes.insert(nodes.begin() + idx, node);
 
     for (size_t after = idx; after != nodes.size(); ++after)
-        nodes[after]->idx_ = after;
+        nodes[after]->idx_ = static_cast<uint32_t>(after);
 
     // We do not need to update the statistics; Route::update() will handle
     // that later. We just need to ensure the right client data is inserted.
@@ -130,15 +146,15 @@ void Route::insert(size_t idx, Node *node)
     distBefore.emplace(distBefore.begin() + idx, node->client());
     distAfter.emplace(distAfter.begin() + idx, node->client());
 
-    ProblemData::Client const &client = data.location(node->client());
+    LoadSegment const loadSegment(data, node->client());
+    loadAt.insert(loadAt.begin() + idx, loadSegment);
+    loadAfter.insert(loadAfter.begin() + idx, loadSegment);
+    loadBefore.insert(loadBefore.begin() + idx, loadSegment);
 
-    loadAt.emplace(loadAt.begin() + idx, client);
-    loadAfter.emplace(loadAfter.begin() + idx, client);
-    loadBefore.emplace(loadBefore.begin() + idx, client);
-
-    durAt.emplace(durAt.begin() + idx, node->client(), client);
-    durAfter.emplace(durAfter.begin() + idx, node->client(), client);
-    durBefore.emplace(durBefore.begin() + idx, node->client(), client);
+    DurationSegment const durSegment(data, node->client());
+    durAt.insert(durAt.begin() + idx, durSegment);
+    durAfter.insert(durAfter.begin() + idx, durSegment);
+    durBefore.insert(durBefore.begin() + idx, durSegment);
 
 #ifndef NDEBUG
     dirty = true;
@@ -167,7 +183,7 @@ void Route::remove(size_t idx)
     nodes.erase(nodes.begin() + idx);
 
     for (auto after = idx; after != nodes.size(); ++after)
-        nodes[after]->idx_ = after;
+        nodes[after]->idx_ = static_cast<uint32_t>(after);
 
     distAt.erase(distAt.begin() + idx);
     distBefore.erase(distBefore.begin() + idx);
@@ -215,17 +231,12 @@ void Route::update()
 {
     centroid_ = {0, 0};
 
-    for (size_t idx = 1; idx != nodes.size(); ++idx)
+    auto const &xs = data.x();
+    auto const &ys = data.y();
+    for (auto const *node : *this)  // clients only; excludes the depots
     {
-        auto const *node = nodes[idx];
-        size_t const client = node->client();
-
-        if (!node->isDepot())
-        {
-            ProblemData::Client const &clientData = data.location(client);
-            centroid_.first += static_cast<double>(clientData.x) / size();
-            centroid_.second += static_cast<double>(clientData.y) / size();
-        }
+        centroid_.first += static_cast<double>(xs[node->client()]) / size();
+        centroid_.second += static_cast<double>(ys[node->client()]) / size();
     }
 
     // Backward segments (depot -> client).
@@ -257,11 +268,21 @@ void Route::update()
 #endif
     }
 
+    updateSummary();
+
 #ifndef NDEBUG
     dirty = false;
 #endif
 }
 
+void Route::updateSummary()
+{
+    summary.distance = distBefore.back().distance();
+    summary.load = loadBefore.back().load();
+    summary.duration = durBefore.back().duration();
+    summary.timeWarp = durBefore.back().timeWarp(maxDuration());
+}
+
 std::ostream &operator<<(std::ostream &out, pyvrp::search::Route const &route)
 {
     out << "Route #" << route.idx() + 1 << ":";  // route number
@@ -7,6 +7,7 @@
 #include "ProblemData.h"
 
 #include <cassert>
+#include <cstdint>
 #include <iosfwd>
 
 namespace pyvrp::search
@@ -71,8 +72,11 @@ public:
     {
         friend class Route;
 
-        size_t loc_;    // Location represented by this node
-        size_t idx_;    // Position in the route
+        // Locations and route positions are stored as 32-bit integers. That
+        // keeps a node at 16 bytes rather than 24, which shrinks the node
+        // array the local search iterates over by a third.
+        uint32_t loc_;  // Location represented by this node
+        uint32_t idx_;  // Position in the route
         Route *route_;  // Indicates membership of a route, if any
 
     public:
@@ -177,6 +181,28 @@ private:
     size_t const vehTypeIdx_;
     size_t const idx_;
 
+    // Compact summary of the route's current totals, and of the vehicle
+    // type's unit costs and limits. Delta cost evaluation reads the route's
+    // current state from here, so that each evaluation touches a single cache
+    // line per route rather than the segment vectors and the vehicle type.
+    // The maximum duration is only needed to evaluate the proposed duration
+    // segment, and does not fit: it is read from the vehicle type instead.
+    struct alignas(64) Summary
+    {
+        Distance distance;
+        Cost unitDistanceCost;
+        Distance maxDistance;
+        Load load;
+        Load capacity;
+        Duration duration;
+        Cost unitDurationCost;
+        Duration timeWarp;
+    };
+
+    static_assert(sizeof(Summary) == 64);
+
+    Summary summary;
+
     std::vector<Node *> nodes;  // Nodes in this route, including depots
     std::pair<double, double> centroid_;  // Center point of route's clients
 
@@ -195,6 +221,9 @@ private:
     std::vector<DurationSegment> durAfter;   // Dur of client -> depot (incl.)
     std::vector<DurationSegment> durBefore;  // Dur of depot -> client (incl.)
 
+    // Refreshes the current totals in the summary from the segments.
+    void updateSummary();
+
 #ifndef NDEBUG
     // When debug assertions are enabled, we use this flag to check whether
     // the statistics are still in sync with the route's nodes list. Statistics
@@ -378,6 +407,13 @@ public:
      */
     [[nodiscard]] inline ProxyBetween between(size_t start, size_t end) const;
 
+    /**
+     * Hints the processor to bring the cached segment data around ``idx`` into
+     * cache, ahead of evaluating moves involving the node at that index. This
+     * does not change the route, and is a no-op on unsupported compilers.
+     */
+    inline void prefetch(size_t idx) const;
+
     /**
      * Center point of the client locations on this route.
      */
@@ -593,6 +629,22 @@ bool Route::hasTimeWarp() const
 #endif
 }
 
+void Route::prefetch([[maybe_unused]] size_t idx) const
+{
+    assert(idx < nodes.size());
+
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(&distBefore[idx]);
+    __builtin_prefetch(&distAfter[idx]);
+    __builtin_prefetch(&loadBefore[idx]);
+    __builtin_prefetch(&loadAfter[idx]);
+#ifndef PYVRP_NO_TIME_WINDOWS
+    __builtin_prefetch(&durBefore[idx]);
+    __builtin_prefetch(&durAfter[idx]);
+#endif
+#endif
+}
+
 size_t Route::idx() const { return idx_; }
 
 Route::Node *Route::operator[](size_t idx)
@@ -610,22 +662,22 @@ Route::Proposal<Segments...> Route::proposal(Segments &&...segments) const
 Load Route::load() const
 {
     assert(!dirty);
-    return loadBefore.back().load();
+    return summary.load;
 }
 
 Load Route::excessLoad() const
 {
     assert(!dirty);
-    return std::max<Load>(load() - capacity(), 0);
+    return std::max<Load>(summary.load - summary.capacity, 0);
 }
 
 Distance Route::excessDistance() const
 {
     assert(!dirty);
-    return std::max<Distance>(distance() - maxDistance(), 0);
+    return std::max<Distance>(summary.distance - summary.maxDistance, 0);
 }
 
-Load Route::capacity() const { return vehicleType_.capacity; }
+Load Route::capacity() const { return summary.capacity; }
 
 size_t Route::depot() const { return vehicleType_.depot; }
 
@@ -634,39 +686,39 @@ Cost Route::fixedVehicleCost() const { return vehicleType_.fixedCost; }
 Distance Route::distance() const
 {
     assert(!dirty);
-    return distBefore.back().distance();
+    return summary.distance;
 }
 
 Cost Route::distanceCost() const
 {
     assert(!dirty);
-    return unitDistanceCost() * static_cast<Cost>(distance());
+    return summary.unitDistanceCost * static_cast<Cost>(summary.distance);
 }
 
-Cost Route::unitDistanceCost() const { return vehicleType_.unitDistanceCost; }
+Cost Route::unitDistanceCost() const { return summary.unitDistanceCost; }
 
 Duration Route::duration() const
 {
     assert(!dirty);
-    return durBefore.back().duration();
+    return summary.duration;
 }
 
 Cost Route::durationCost() const
 {
     assert(!dirty);
-    return unitDurationCost() * static_cast<Cost>(duration());
+    return summary.unitDurationCost * static_cast<Cost>(summary.duration);
 }
 
-Cost Route::unitDurationCost() const { return vehicleType_.unitDurationCost; }
+Cost Route::unitDurationCost() const { return summary.unitDurationCost; }
 
 Duration Route::maxDuration() const { return vehicleType_.maxDuration; }
 
-Distance Route::maxDistance() const { return vehicleType_.maxDistance; }
+Distance Route::maxDistance() const { return summary.maxDistance; }
 
 Duration Route::timeWarp() const
 {
     assert(!dirty);
-    return durBefore.back().timeWarp(maxDuration());
+    return summary.timeWarp;
 }
 
 size_t Route::profile() const { return vehicleType_.profile; }
@@ -0,0 +1,155 @@
+#ifndef PYVRP_SEGMENTCACHE_H
+#define PYVRP_SEGMENTCACHE_H
+
+#include "DistanceSegment.h"
+#include "DurationSegment.h"
+#include "LoadSegment.h"
+#include "ProblemData.h"
+#include "Route.h"
+
+#include <cassert>
+#include <vector>
+
+namespace pyvrp::search
+{
+/**
+ * Lazily computes and caches the load and duration data of the short route
+ * segments starting at a given node. Node operators that evaluate moves around
+ * the same node share these segments through the local search, rather than
+ * each recomputing them from the node's route.
+ *
+ * The cache must be reset whenever the node's route changes.
+ */
+class SegmentCache
+{
+public:
+    /**
+     * Proxy for the route segment of ``length`` clients that starts at the
+     * cached node. Can be used wherever a route segment is expected.
+     */
+    class Segment
+    {
+        SegmentCache const *cache;
+        size_t const length;
+
+    public:
+        inline Segment(SegmentCache const &cache, size_t length);
+        inline operator DistanceSegment() const;
+        inline operator DurationSegment const &() const;
+        inline operator LoadSegment const &() const;
+    };
+
+private:
+    ProblemData const &data;
+    Route::Node const *node_ = nullptr;
+
+    // Segments of two or more clients, computed on demand: entry i stores the
+    // segment of length i + 2. Segments of a single client are read directly
+    // from the route.
+    mutable std::vector<DurationSegment> durs;
+    mutable std::vector<LoadSegment> loads;
+
+public:
+    /**
+     * @return The node whose segments are currently cached, if any.
+     */
+    [[nodiscard]] inline Route::Node const *node() const;
+
+    /**
+     * Clears the cache, and associates it with the given node.
+     */
+    inline void reset(Route::Node const *node = nullptr);
+
+    /**
+     * Returns a proxy for the segment of ``length`` clients starting at the
+     * cached node. Assumes this segment does not contain a depot.
+     */
+    [[nodiscard]] inline Segment segment(size_t length) const;
+
+    inline SegmentCache(ProblemData const &data);
+};
+
+SegmentCache::Segment::Segment(SegmentCache const &cache, size_t length)
+    : cache(&cache), length(length)
+{
+    assert(cache.node_ && cache.node_->route() && length > 0);
+    assert(cache.node_->idx() + length - 1 <= cache.node_->route()->size());
+}
+
+SegmentCache::Segment::operator DistanceSegment() const
+{
+    auto const *node = cache->node_;
+    auto const *route = node->route();
+    return route->between(node->idx(), node->idx() + length - 1);
+}
+
+SegmentCache::Segment::operator DurationSegment const &() const
+{
+    auto const *node = cache->node_;
+    auto const *route = node->route();
+
+    if (length == 1)
+        return route->at(node->idx());
+
+    auto &durs = cache->durs;
+    auto const &durMat = cache->data.durationMatrix(route->profile());
+    while (durs.size() < length - 1)
+    {
+        auto const idx = node->idx() + durs.size() + 1;
+        auto const &prev
+            = durs.empty()
+                  ? static_cast<DurationSegment const &>(route->at(node->idx()))
+                  : durs.back();
+        durs.push_back(DurationSegment::merge(durMat, prev, route->at(idx)));
+    }
+
+    return durs[length - 2];
+}
+
+SegmentCache::Segment::operator LoadSegment const &() const
+{
+    auto const *node = cache->node_;
+    auto const *route = node->route();
+
+    if (length == 1)
+        return route->at(node->idx());
+
+    auto &loads = cache->loads;
+    while (loads.size() < length - 1)
+    {
+        auto const idx = node->idx() + loads.size() + 1;
+        auto const &prev
+            = loads.empty()
+                  ? static_cast<LoadSegment const &>(route->at(node->idx()))
+                  : loads.back();
+        loads.push_back(LoadSegment::merge(prev, route->at(idx)));
+    }
+
+    return loads[length - 2];
+}
+
+Route::Node const *SegmentCache::node() const { return node_; }
+
+void SegmentCache::reset(Route::Node const *node)
+{
+    node_ = node;
+    durs.clear();
+    loads.clear();
+}
+
+SegmentCache::Segment SegmentCache::segment(size_t length) const
+{
+    return {*this, length};
+}
+
+SegmentCache::SegmentCache(ProblemData const &data) : data(data)
+{
+    // Exchange operators move segments of at most three clients. Reserving
+    // for those ensures references to cached segments remain valid while
+    // longer segments are computed.
+    durs.reserve(2);
+    loads.reserve(2);
+}
+}  // namespace pyvrp::search
+
+#endif  // PYVRP_SEGMENTCACHE_H
@@ -1,11 +1,53 @@
 #include "SwapStar.h"
 
+#include <algorithm>
 #include <cassert>
+#include <stdexcept>
 
 using pyvrp::Cost;
 using pyvrp::search::Route;
 using pyvrp::search::SwapStar;
 
+SwapStar::SwapStar(
+    ProblemData const &data,
+    std::optional<std::vector<std::vector<size_t>>> const &neighbours)
+    : LocalSearchOperator<Route>(data),
+      cache(data.numVehicles(), data.numLocations()),
+      removalCosts(data.numVehicles(), data.numLocations()),
+      updated(data.numVehicles(), true)
+{
+    if (!neighbours)
+        return;
+
+    if (neighbours->size() != data.numLocations())
+        throw std::runtime_error("Neighbourhood dimensions do not match.");
+
+    // We evaluate pairs where either client is a neighbour of the other, so
+    // we add the reverse of each neighbour relation as well.
+    this->neighbours.resize(data.numLocations());
+    for (size_t client = 0; client != data.numLocations(); ++client)
+        for (auto const other : (*neighbours)[client])
+        {
+            if (other >= data.numLocations())
+                throw std::runtime_error("Neighbourhood of client "
+                                         + std::to_string(client)
+                                         + " contains unknown locations.");
+
+            this->neighbours[client].push_back(other);
+            this->neighbours[other].push_back(client);
+        }
+
+    for (auto &clientNeighbours : this->neighbours)
+    {
+        std::sort(clientNeighbours.begin(), clientNeighbours.end());
+        auto const last
+            = std::unique(clientNeighbours.begin(), clientNeighbours.end());
+        clientNeighbours.erase(last, clientNeighbours.end());
+    }
+
+    routeVNodes.resize(data.numLocations(), nullptr);
+}
+
 void SwapStar::ThreeBest::maybeAdd(Cost costInsert, Route::Node *placeInsert)
 {
     if (costInsert >= costs[2])
@@ -142,6 +184,62 @@ void SwapStar::init(Solution const &solution)
     std::fill(updated.begin(), updated.end(), true);
 }
 
+void SwapStar::evaluatePair(Route *routeU,
+                            Route *routeV,
+                            Route::Node *U,
+                            Route::Node *V,
+                            CostEvaluator const &costEvaluator)
+{
+    // The following lines compute a delta cost of removing U and V from their
+    // own routes and inserting them into the other's route in the best place.
+    // This is approximate since removal and insertion are evaluated
+    // separately, not taking into account that while U leaves its route, V
+    // will be inserted (and vice versa).
+    Cost deltaCost = 0;
+
+    // Separating removal and insertion means that the effects on load are not
+    // counted correctly: during insert, U is still in the route, and now V is
+    // added as well. The following addresses this issue with an
+    // approximation, which is inexact when there are both pickups and
+    // deliveries in the data. We do not evaluate load when calculating remove
+    // and insert costs - that is all handled here. So it's pretty rough but
+    // fast and seems to work well enough for most instances.
+    auto const uLoad = LoadSegment(data, U->client()).load();
+    auto const vLoad = LoadSegment(data, V->client()).load();
+    auto const loadDiff = uLoad - vLoad;
+
+    deltaCost += costEvaluator.loadPenalty(routeU->load() - loadDiff,
+                                           routeU->capacity());
+    deltaCost -= costEvaluator.loadPenalty(routeU->load(), routeU->capacity());
+
+    deltaCost += costEvaluator.loadPenalty(routeV->load() + loadDiff,
+                                           routeV->capacity());
+    deltaCost -= costEvaluator.loadPenalty(routeV->load(), routeV->capacity());
+
+    deltaCost += removalCosts(routeU->idx(), U->client());
+    deltaCost += removalCosts(routeV->idx(), V->client());
+
+    auto [extraV, UAfter] = getBestInsertPoint(U, V, costEvaluator);
+    deltaCost += extraV;
+
+    if (deltaCost >= 0)  // returning here avoids evaluating another costly
+        return;          // insertion point below
+
+    auto [extraU, VAfter] = getBestInsertPoint(V, U, costEvaluator);
+    deltaCost += extraU;
+
+    if (deltaCost < best.cost)
+    {
+        best.cost = deltaCost;
+
+        best.U = U;
+        best.UAfter = UAfter;
+
+        best.V = V;
+        best.VAfter = VAfter;
+    }
+}
+
 Cost SwapStar::evaluate(Route *routeU,
                         Route *routeV,
                         CostEvaluator const &costEvaluator)
@@ -154,64 +252,38 @@ Cost SwapStar::evaluate(Route *routeU,
     if (updated[routeV->idx()])
         updateRemovalCosts(routeV, costEvaluator);
 
-    for (auto *U : *routeU)
+    if (neighbours.empty())  // evaluate all pairs of clients
+    {
+        for (auto *U : *routeU)
+            for (auto *V : *routeV)
+                evaluatePair(routeU, routeV, U, V, costEvaluator);
+    }
+    else  // evaluate only pairs of neighbouring clients
+    {
         for (auto *V : *routeV)
+            routeVNodes[V->client()] = V;
+
+        // Candidates are evaluated in route order, as they are when evaluating
+        // all pairs. That way, ties are broken in the same way.
+        for (auto *U : *routeU)
         {
-            // The following lines compute a delta cost of removing U and V from
-            // their own routes and inserting them into the other's route in the
-            // best place. This is approximate since removal and insertion are
-            // evaluated separately, not taking into account that while U leaves
-            // its route, V will be inserted (and vice versa).
-            Cost deltaCost = 0;
-
-            // Separating removal and insertion means that the effects on load
-            // are not counted correctly: during insert, U is still in the
-            // route, and now V is added as well. The following addresses this
-            // issue with an approximation, which is inexact when there are both
-            // pickups and deliveries in the data. We do not evaluate load when
-            // calculating remove and insert costs - that is all handled here.
-            // So it's pretty rough but fast and seems to work well enough for
-            // most instances.
-            ProblemData::Client const &uClient = data.location(U->client());
-            ProblemData::Client const &vClient = data.location(V->client());
-            auto const uLoad = std::max(uClient.delivery, uClient.pickup);
-            auto const vLoad = std::max(vClient.delivery, vClient.pickup);
-            auto const loadDiff = uLoad - vLoad;
-
-            deltaCost += costEvaluator.loadPenalty(routeU->load() - loadDiff,
-                                                   routeU->capacity());
-            deltaCost -= costEvaluator.loadPenalty(routeU->load(),
-                                                   routeU->capacity());
-
-            deltaCost += costEvaluator.loadPenalty(routeV->load() + loadDiff,
-                                                   routeV->capacity());
-            deltaCost -= costEvaluator.loadPenalty(routeV->load(),
-                                                   routeV->capacity());
-
-            deltaCost += removalCosts(routeU->idx(), U->client());
-            deltaCost += removalCosts(routeV->idx(), V->client());
-
-            auto [extraV, UAfter] = getBestInsertPoint(U, V, costEvaluator);
-            deltaCost += extraV;
-
-            if (deltaCost >= 0)  // continuing here avoids evaluating another
-                continue;        // costly insertion point below
-
-            auto [extraU, VAfter] = getBestInsertPoint(V, U, costEvaluator);
-            deltaCost += extraU;
-
-            if (deltaCost < best.cost)
-            {
-                best.cost = deltaCost;
-
-                best.U = U;
-                best.UAfter = UAfter;
-
-                best.V = V;
-                best.VAfter = VAfter;
-            }
+            candidates.clear();
+            for (auto const client : neighbours[U->client()])
+                if (auto *V = routeVNodes[client])
+                    candidates.push_back(V);
+
+            std::sort(candidates.begin(),
+                      candidates.end(),
+                      [](auto *V1, auto *V2) { return V1->idx() < V2->idx(); });
+
+            for (auto *V : candidates)
+                evaluatePair(routeU, routeV, U, V, costEvaluator);
         }
 
+        for (auto *V : *routeV)
+            routeVNodes[V->client()] = nullptr;
+    }
+
     // It is possible for positive delta costs to turn negative when we do an
     // exact evaluation. But in practice that almost never happens, and is not
     // worth spending time on.
@@ -7,18 +7,38 @@
 
 #include <array>
 #include <limits>
+#include <optional>
 #include <vector>
 
 namespace pyvrp::search
 {
 /**
- * SwapStar(data: ProblemData)
+ * SwapStar(data: ProblemData, neighbours: Optional[list[list[int]]] = None)
  *
  * Explores the SWAP* neighbourhood of [1]_. The SWAP* neighbourhood explores
  * free form re-insertions of clients :math:`U` and :math:`V` in the given
  * routes (so the clients are exchanged between routes, but they are not
  * necessarily inserted in the place of the other exchanged client).
  *
+ * By default, all pairs of clients :math:`U` and :math:`V` in the given routes
+ * are evaluated. When a granular neighbourhood is passed, only those pairs are
+ * evaluated where :math:`V` is a neighbour of :math:`U`, or vice versa. Then
+ * the work per pair of routes grows with the neighbourhood size rather than
+ * with the product of the route lengths.
+ *
+ * Parameters
+ * ----------
+ * data
+ *     Data instance.
+ * neighbours
+ *     Optional granular neighbourhood, as a list of neighbours for each
+ *     location. When not provided, all pairs of clients are evaluated.
+ *
+ * Raises
+ * ------
+ * RuntimeError
+ *     When the neighbourhood dimensions do not match the data instance.
+ *
  * References
  * ----------
  * .. [1] Thibaut Vidal. 2022. Hybrid genetic search for the CVRP: Open-source
@@ -53,8 +73,22 @@ class SwapStar : public LocalSearchOperator<Route>
     Matrix<Cost> removalCosts;
     std::vector<bool> updated;
 
+    // Symmetric neighbour lists, or empty when all pairs are evaluated. The
+    // nodes of the second route are looked up by client in routeVNodes.
+    std::vector<std::vector<size_t>> neighbours;
+    std::vector<Route::Node *> routeVNodes;
+    std::vector<Route::Node *> candidates;
+
     BestMove best;
 
+    // Evaluates exchanging U and V, and updates the best move if this is an
+    // improvement.
+    void evaluatePair(Route *routeU,
+                      Route *routeV,
+                      Route::Node *U,
+                      Route::Node *V,
+                      CostEvaluator const &costEvaluator);
+
     // Updates the removal costs of clients in the given route
     void updateRemovalCosts(Route *R, CostEvaluator const &costEvaluator);
 
@@ -86,13 +120,10 @@ public:
 
     void update(Route *U) override;
 
-    explicit SwapStar(ProblemData const &data)
-        : LocalSearchOperator<Route>(data),
-          cache(data.numVehicles(), data.numLocations()),
-          removalCosts(data.numVehicles(), data.numLocations()),
-          updated(data.numVehicles(), true)
-    {
-    }
+    explicit SwapStar(
+        ProblemData const &data,
+        std::optional<std::vector<std::vector<size_t>>> const &neighbours
+        = std::nullopt);
 };
 }  // namespace pyvrp::search
 
@@ -1,6 +1,7 @@
 #include "bindings.h"
 #include "Exchange.h"
 #include "LocalSearch.h"
+#include "OperatorPlugin.h"
 #include "Route.h"
 #include "SwapRoutes.h"
 #include "SwapStar.h"
@@ -20,19 +21,35 @@ using pyvrp::search::inplaceCost;
 using pyvrp::search::insertCost;
 using pyvrp::search::LocalSearch;
 using pyvrp::search::LocalSearchOperator;
+using pyvrp::search::OperatorPlugin;
 using pyvrp::search::removeCost;
 using pyvrp::search::Route;
 using pyvrp::search::SwapRoutes;
 using pyvrp::search::SwapStar;
 using pyvrp::search::SwapTails;
 
-PYBIND11_MODULE(_search, m)
+PYVRP_MODULE(_search, m)
 {
     using NodeOp = LocalSearchOperator<pyvrp::search::Route::Node>;
     using RouteOp = LocalSearchOperator<pyvrp::search::Route>;
 
-    py::class_<NodeOp>(m, "NodeOperator");
-    py::class_<RouteOp>(m, "RouteOperator");
+    // The base classes also expose evaluate and apply, so that operators
+    // created by an OperatorPlugin can be used directly from Python.
+    py::class_<NodeOp>(m, "NodeOperator")
+        .def("evaluate",
+             &NodeOp::evaluate,
+             py::arg("U"),
+             py::arg("V"),
+             py::arg("cost_evaluator"))
+        .def("apply", &NodeOp::apply, py::arg("U"), py::arg("V"));
+
+    py::class_<RouteOp>(m, "RouteOperator")
+        .def("evaluate",
+             &RouteOp::evaluate,
+             py::arg("U"),
+             py::arg("V"),
+             py::arg("cost_evaluator"))
+        .def("apply", &RouteOp::apply, py::arg("U"), py::arg("V"));
 
     py::class_<Exchange<1, 0>, NodeOp>(
         m, "Exchange10", DOC(pyvrp, search, Exchange))
@@ -155,8 +172,10 @@ PYBIND11_MODULE(_search, m)
         .def("apply", &SwapRoutes::apply, py::arg("U"), py::arg("V"));
 
     py::class_<SwapStar, RouteOp>(m, "SwapStar", DOC(pyvrp, search, SwapStar))
-        .def(py::init<pyvrp::ProblemData const &>(),
+        .def(py::init<pyvrp::ProblemData const &,
+                      std::optional<std::vector<std::vector<size_t>>>>(),
              py::arg("data"),
+             py::arg("neighbours") = py::none(),
              py::keep_alive<1, 2>())  // keep data alive
         .def("evaluate",
              &SwapStar::evaluate,
@@ -190,31 +209,62 @@ PYBIND11_MODULE(_search, m)
              &LocalSearch::addRouteOperator,
              py::arg("op"),
              py::keep_alive<1, 2>())
+        .def("set_adaptive", &LocalSearch::setAdaptive, py::arg("adaptive"))
+        .def("node_operator_yields", &LocalSearch::nodeOperatorYields)
+        .def("set_num_active_neighbours",
+             &LocalSearch::setNumActiveNeighbours,
+             py::arg("num_active_neighbours"))
+        .def("num_active_neighbours", &LocalSearch::numActiveNeighbours)
         .def("set_neighbours",
              &LocalSearch::setNeighbours,
              py::arg("neighbours"))
         .def("neighbours",
              &LocalSearch::neighbours,
              py::return_value_policy::reference_internal)
+        // The search itself does not touch any Python objects, so we release
+        // the GIL while it runs. That lets other threads continue, including
+        // threads running a search with another local search object.
         .def("__call__",
              &LocalSearch::operator(),
              py::arg("solution"),
-             py::arg("cost_evaluator"))
+             py::arg("cost_evaluator"),
+             py::call_guard<py::gil_scoped_release>())
         .def("search",
              py::overload_cast<pyvrp::Solution const &,
                                pyvrp::CostEvaluator const &>(
                  &LocalSearch::search),
              py::arg("solution"),
-             py::arg("cost_evaluator"))
+             py::arg("cost_evaluator"),
+             py::call_guard<py::gil_scoped_release>())
         .def("intensify",
              py::overload_cast<pyvrp::Solution const &,
                                pyvrp::CostEvaluator const &,
                                double const>(&LocalSearch::intensify),
              py::arg("solution"),
              py::arg("cost_evaluator"),
-             py::arg("overlap_tolerance") = 0.05)
+             py::arg("overlap_tolerance") = 0.05,
+             py::call_guard<py::gil_scoped_release>())
         .def("shuffle", &LocalSearch::shuffle, py::arg("rng"));
 
+    py::class_<OperatorPlugin>(
+        m, "OperatorPlugin", DOC(pyvrp, search, OperatorPlugin))
+        .def(py::init<std::string>(), py::arg("path"))
+        .def_property_readonly("path", &OperatorPlugin::path)
+        .def("node_operators", &OperatorPlugin::nodeOperators)
+        .def("route_operators", &OperatorPlugin::routeOperators)
+        .def("node_operator",
+             &OperatorPlugin::nodeOperator,
+             py::arg("name"),
+             py::arg("data"),
+             py::keep_alive<0, 1>(),  // keep plugin alive until op is freed
+             py::keep_alive<0, 3>())  // keep data alive
+        .def("route_operator",
+             &OperatorPlugin::routeOperator,
+             py::arg("name"),
+             py::arg("data"),
+             py::keep_alive<0, 1>(),  // keep plugin alive until op is freed
+             py::keep_alive<0, 3>());  // keep data alive
+
     py::class_<Route>(m, "Route", DOC(pyvrp, search, Route))
         .def(py::init<pyvrp::ProblemData const &, size_t, size_t>(),
              py::arg("data"),
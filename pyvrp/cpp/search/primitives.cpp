@@ -24,14 +24,12 @@ public:
 
     operator pyvrp::DurationSegment() const
     {
-        pyvrp::ProblemData::Client const &clientData = data.location(client);
-        return pyvrp::DurationSegment(client, clientData);
+        return pyvrp::DurationSegment(data, client);
     }
 
     operator pyvrp::LoadSegment() const
     {
-        pyvrp::ProblemData::Client const &clientData = data.location(client);
-        return pyvrp::LoadSegment(clientData);
+        return pyvrp::LoadSegment(data, client);
     }
 };
 }  // namespace
@@ -45,10 +43,8 @@ pyvrp::Cost pyvrp::search::insertCost(Route::Node *U,
         return 0;
 
     auto *route = V->route();
-    ProblemData::Client const &client = data.location(U->client());
-
-    Cost deltaCost
-        = Cost(route->empty()) * route->fixedVehicleCost() - client.prize;
+    Cost deltaCost = Cost(route->empty()) * route->fixedVehicleCost()
+                     - data.prize()[U->client()];
 
     costEvaluator.deltaCost<true>(
         deltaCost,
@@ -67,10 +63,8 @@ pyvrp::Cost pyvrp::search::removeCost(Route::Node *U,
         return 0;
 
     auto *route = U->route();
-    ProblemData::Client const &client = data.location(U->client());
-
-    Cost deltaCost
-        = client.prize - Cost(route->size() == 1) * route->fixedVehicleCost();
+    Cost deltaCost = data.prize()[U->client()]
+                     - Cost(route->size() == 1) * route->fixedVehicleCost();
 
     costEvaluator.deltaCost<true>(deltaCost,
                                   route->proposal(route->before(U->idx() - 1),
@@ -88,10 +82,8 @@ pyvrp::Cost pyvrp::search::inplaceCost(Route::Node *U,
         return 0;
 
     auto const *route = V->route();
-    ProblemData::Client const &uClient = data.location(U->client());
-    ProblemData::Client const &vClient = data.location(V->client());
-
-    Cost deltaCost = vClient.prize - uClient.prize;
+    auto const &prize = data.prize();
+    Cost deltaCost = prize[V->client()] - prize[U->client()];
 
     costEvaluator.deltaCost<true>(
         deltaCost,
@@ -5,6 +5,12 @@ def ordered_crossover(
     data: ProblemData,
     indices: tuple[int, int],
 ) -> Solution: ...
+def ordered_split_crossover(
+    parents: tuple[Solution, Solution],
+    data: ProblemData,
+    cost_evaluator: CostEvaluator,
+    indices: tuple[int, int],
+) -> Solution: ...
 def selective_route_exchange(
     parents: tuple[Solution, Solution],
     data: ProblemData,
@@ -12,3 +18,8 @@ def selective_route_exchange(
     start_indices: tuple[int, int],
     num_moved_routes: int,
 ) -> Solution: ...
+def split(
+    tour: list[int],
+    data: ProblemData,
+    cost_evaluator: CostEvaluator,
+) -> Solution: ...
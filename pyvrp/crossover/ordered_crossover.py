@@ -5,6 +5,7 @@ from pyvrp._pyvrp import (
     Solution,
 )
 from pyvrp.crossover._crossover import ordered_crossover as _ox
+from pyvrp.crossover._crossover import ordered_split_crossover as _split_ox
 
 
 def ordered_crossover(
@@ -15,14 +16,23 @@ def ordered_crossover(
 ) -> Solution:
     """
     Performs an ordered crossover (OX) operation between the two given parents.
-    The clients between two randomly selected indices of the first route are
-    copied into a new solution, and any missing clients that are present in the
-    second route are then copied in as well. See [1]_ for details.
+    The clients between two randomly selected indices of the first parent's
+    route are copied into a new solution, and any missing clients that are
+    present in the second parent's route are then copied in as well. See [1]_
+    for details.
 
-    .. warning::
+    When there are multiple vehicles, OX is applied to the giant tours of the
+    parents, which concatenate the visits of all their routes. The offspring
+    giant tour is then optimally split into routes, using the linear-time split
+    algorithm of [2]_ where possible. This split respects the order of the
+    giant tour, and uses at most as many routes as there are vehicles. No
+    further repair is needed.
 
-       This operator explicitly assumes the problem instance is a TSP. You
-       should use a different crossover operator if that is not the case.
+    .. note::
+
+       This operator assumes a homogeneous fleet: all vehicles must be of the
+       same vehicle type. You should use a different crossover operator if that
+       is not the case.
 
     Parameters
     ----------
@@ -31,7 +41,8 @@ def ordered_crossover(
     data
         The problem instance.
     cost_evaluator
-        Cost evaluator object. Unused by this operator.
+        Cost evaluator object. Used to split the offspring's giant tour into
+        routes when there are multiple vehicles.
     rng
         The random number generator to use.
 
@@ -43,8 +54,7 @@ def ordered_crossover(
     Raises
     ------
     ValueError
-        When the given data instance is not a TSP, particularly, when there is
-        more than one vehicle in the data.
+        When the given data instance has more than one vehicle type.
 
     References
     ----------
@@ -52,9 +62,12 @@ def ordered_crossover(
            permutation crossover operators on the traveling salesman problem.
            In *Proceedings of the Second International Conference on Genetic
            Algorithms on Genetic algorithms and their application*. 224 - 230.
+    .. [2] T. Vidal. 2016. Technical note: Split algorithm in O(n) for the
+           capacitated vehicle routing problem. *Computers & Operations
+           Research*, 69: 40 - 47.
     """
-    if data.num_vehicles != 1:
-        msg = f"Expected a TSP, got {data.num_vehicles} vehicles instead."
+    if data.num_vehicle_types != 1:
+        msg = f"Expected one vehicle type, got {data.num_vehicle_types}."
         raise ValueError(msg)
 
     first, second = parents
@@ -65,16 +78,19 @@ def ordered_crossover(
     if second.num_clients() == 0:
         return first
 
-    # Generate [start, end) indices in the route of the first parent solution.
-    # If end < start, the index segment wraps around. Clients in this index
-    # segment are copied verbatim into the offspring solution.
-    first_route = first.routes()[0]
-    start = rng.randint(len(first_route))
-    end = rng.randint(len(first_route))
+    # Generate [start, end) indices in the (giant) tour of the first parent
+    # solution. If end < start, the index segment wraps around. Clients in
+    # this index segment are copied verbatim into the offspring solution.
+    num_clients = first.num_clients()
+    start = rng.randint(num_clients)
+    end = rng.randint(num_clients)
 
     # When start == end we try to find a different end index, such that the
     # offspring actually inherits something from each parent.
-    while start == end and len(first_route) > 1:
-        end = rng.randint(len(first_route))
+    while start == end and num_clients > 1:
+        end = rng.randint(num_clients)
+
+    if data.num_vehicles == 1:
+        return _ox(parents, data, (start, end))
 
-    return _ox(parents, data, (start, end))
+    return _split_ox(parents, data, cost_evaluator, (start, end))
@@ -0,0 +1,390 @@
+from __future__ import annotations
+
+import time
+from dataclasses import dataclass
+from typing import TYPE_CHECKING
+
+import numpy as np
+
+from pyvrp.PenaltyManager import PenaltyManager
+from pyvrp.Result import Result
+from pyvrp._pyvrp import (
+    Client,
+    ClientGroup,
+    ProblemData,
+    RandomNumberGenerator,
+    Route,
+    Solution,
+)
+from pyvrp.search import LocalSearch, compute_neighbours
+from pyvrp.solve import SolveParams, solve
+
+if TYPE_CHECKING:
+    from pyvrp.stop import StoppingCriterion
+
+# Maximum number of matrix entries evaluated at once when looking for nearest
+# neighbours. This bounds the memory use of the coarsening step on very large
+# instances.
+_CHUNK_SIZE = 1 << 22
+
+
+@dataclass
+class MultilevelParams:
+    """
+    Parameters for the multilevel solver.
+
+    Parameters
+    ----------
+    num_clients
+        The instance is coarsened until it has at most this many clients.
+    max_levels
+        Maximum number of coarsening levels.
+    min_reduction
+        Coarsening stops early when a level would reduce the number of clients
+        by less than this fraction (in :math:`[0, 1]`).
+
+    Attributes
+    ----------
+    num_clients
+        Number of clients at which coarsening stops.
+    max_levels
+        Maximum number of coarsening levels.
+    min_reduction
+        Minimum fraction by which each level must reduce the number of clients.
+
+    Raises
+    ------
+    ValueError
+        When ``num_clients`` or ``max_levels`` is negative, or
+        ``min_reduction`` is not in :math:`[0, 1]`.
+    """
+
+    num_clients: int = 1_000
+    max_levels: int = 10
+    min_reduction: float = 0.05
+
+    def __post_init__(self):
+        if self.num_clients < 0:
+            raise ValueError("num_clients < 0 not understood.")
+
+        if self.max_levels < 0:
+            raise ValueError("max_levels < 0 not understood.")
+
+        if not 0 <= self.min_reduction <= 1:
+            raise ValueError("min_reduction must be in [0, 1].")
+
+
+def _merge_costs(
+    data: ProblemData,
+    mergeable: np.ndarray,
+    capacity: int,
+    first: np.ndarray,
+    second: np.ndarray,
+) -> np.ndarray:
+    """
+    Returns the distance from each client in ``first`` to each client in
+    ``second``, or ``inf`` when the pair cannot be merged into a single client
+    that first visits the client in ``first``, and then that in ``second``.
+    """
+    rows, cols = np.ix_(first, second)
+    dist = data.distance_matrix(0)[rows, cols].astype(float)
+    dur = data.duration_matrix(0)[rows, cols]
+
+    # The merged client is served without waiting between its two visits. That
+    # is possible when the visits' time windows and release times are
+    # compatible, given the travel duration between them.
+    tw_early = data.tw_early()
+    tw_late = data.tw_late()
+    release_time = data.release_time()
+
+    offset = data.service_duration()[rows] + dur
+    early = np.maximum(tw_early[rows], tw_early[cols] - offset)
+    late = np.minimum(tw_late[rows], tw_late[cols] - offset)
+    release = np.maximum(release_time[rows], release_time[cols])
+
+    delivery = data.delivery()[rows] + data.delivery()[cols]
+    pickup = data.pickup()[rows] + data.pickup()[cols]
+
+    feasible = (
+        mergeable[rows]
+        & mergeable[cols]
+        & (rows != cols)
+        & (early <= late)
+        & (release <= late)
+        & (delivery <= capacity)
+        & (pickup <= capacity)
+    )
+
+    # The internal travel duration of a merged client is part of its service
+    # duration, so it must not depend on the vehicle's profile.
+    for profile in range(1, data.num_profiles):
+        feasible &= data.duration_matrix(profile)[rows, cols] == dur
+
+    return np.where(feasible, dist, np.inf)
+
+
+def _merged_client(data: ProblemData, first: int, second: int) -> Client:
+    """
+    Returns a client that first visits ``first``, and then ``second``.
+    """
+    client1 = data.location(first)
+    client2 = data.location(second)
+    travel = int(data.duration_matrix(0)[first, second])
+    offset = client1.service_duration + travel
+
+    return Client(
+        x=client1.x,
+        y=client1.y,
+        delivery=client1.delivery + client2.delivery,
+        pickup=client1.pickup + client2.pickup,
+        service_duration=offset + client2.service_duration,
+        tw_early=max(client1.tw_early, client2.tw_early - offset),
+        tw_late=min(client1.tw_late, client2.tw_late - offset),
+        release_time=max(client1.release_time, client2.release_time),
+        prize=client1.prize + client2.prize,
+        required=True,
+    )
+
+
+def coarsen(data: ProblemData) -> tuple[ProblemData, list[list[int]]]:
+    """
+    Coarsens the given instance by merging pairs of clients into single
+    clients. Two clients are merged when they are each other's nearest
+    neighbour, and can be visited one after the other without exceeding the
+    vehicle capacity, and without waiting or time warp between the visits.
+    Optional clients and clients in a client group are not merged.
+
+    The merged client visits the pair in a fixed order. Its service duration
+    includes the travel duration between the pair, and the travel distance
+    between the pair is added to all distances leaving the merged client. Any
+    route in the coarse instance thus has the same distance and duration as
+    the corresponding route in the original instance.
+
+    Parameters
+    ----------
+    data
+        Data instance to coarsen.
+
+    Returns
+    -------
+    tuple
+        The coarse data instance, and for each client in the coarse instance,
+        the clients in the given instance it visits, in order.
+    """
+    num_depots = data.num_depots
+    num_clients = data.num_clients
+    clients = np.arange(num_depots, data.num_locations)
+
+    mergeable = np.zeros(data.num_locations, dtype=bool)
+    for idx, client in enumerate(data.clients(), num_depots):
+        mergeable[idx] = client.required and client.group is None
+
+    capacity = min(veh_type.capacity for veh_type in data.vehicle_types())
+
+    # For each client, find the nearest client it can be merged with, in
+    # either order. We evaluate this in chunks of rows to bound memory use.
+    nearest = np.full(num_clients, -1)
+    visits_first = np.zeros(num_clients, dtype=bool)
+    chunk = max(_CHUNK_SIZE // max(num_clients, 1), 1)
+
+    for start in range(0, num_clients, chunk):
+        rows = clients[start : start + chunk]
+        costs_to = _merge_costs(data, mergeable, capacity, rows, clients)
+        costs_from = _merge_costs(data, mergeable, capacity, clients, rows).T
+        costs = np.minimum(costs_to, costs_from)
+
+        idcs = np.arange(len(rows))
+        best = costs.argmin(axis=1)
+        found = np.isfinite(costs[idcs, best])
+
+        end = start + len(rows)
+        nearest[start:end] = np.where(found, best, -1)
+        to_best = costs_to[idcs, best]
+        visits_first[start:end] = to_best <= costs_from[idcs, best]
+
+    # Clients that are each other's nearest neighbours are merged. All other
+    # clients remain as they are.
+    coarse_clients = []
+    clusters = []
+    for idx in range(num_clients):
+        other = nearest[idx]
+        if other >= 0 and nearest[other] == idx:
+            if idx > other:  # already merged when we visited the other client
+                continue
+
+            pair = [idx, other] if visits_first[idx] else [other, idx]
+            locs = [num_depots + client for client in pair]
+            coarse_clients.append(_merged_client(data, *locs))
+            clusters.append(locs)
+        else:
+            coarse_clients.append(data.location(num_depots + idx))
+            clusters.append([num_depots + idx])
+
+    # Coarse locations are the depots, followed by the coarse clients. Travel
+    # from a coarse location starts at the last client it visits, and travel
+    # to a coarse location ends at the first client it visits.
+    depots = list(range(num_depots))
+    first = np.array(depots + [cluster[0] for cluster in clusters])
+    last = np.array(depots + [cluster[-1] for cluster in clusters])
+
+    dist_mats = []
+    for dist_mat in data.distance_matrices():
+        internal = dist_mat[first, last]  # zero for depots and singletons
+        coarse_mat = dist_mat[np.ix_(last, first)] + internal[:, np.newaxis]
+        np.fill_diagonal(coarse_mat, 0)
+        dist_mats.append(coarse_mat)
+
+    dur_mats = []
+    for dur_mat in data.duration_matrices():
+        coarse_mat = dur_mat[np.ix_(last, first)]
+        np.fill_diagonal(coarse_mat, 0)
+        dur_mats.append(coarse_mat)
+
+    # Clients in groups are never merged, but their indices may have changed.
+    location_map = {cluster[0]: idx for idx, cluster in enumerate(clusters)}
+    groups = [
+        ClientGroup(
+            [num_depots + location_map[client] for client in group.clients],
+            group.required,
+        )
+        for group in data.groups()
+    ]
+
+    coarse = data.replace(
+        clients=coarse_clients,
+        distance_matrices=dist_mats,
+        duration_matrices=dur_mats,
+        groups=groups,
+    )
+
+    return coarse, clusters
+
+
+def uncoarsen(
+    solution: Solution,
+    data: ProblemData,
+    clusters: list[list[int]],
+) -> Solution:
+    """
+    Turns a solution to a coarse instance into a solution to the given, finer
+    data instance, by replacing each coarse client with the clients it visits.
+
+    Parameters
+    ----------
+    solution
+        Solution to the coarse data instance.
+    data
+        The finer data instance that was coarsened.
+    clusters
+        For each client in the coarse instance, the clients in the finer
+        instance it visits, as returned by :func:`~coarsen`.
+
+    Returns
+    -------
+    Solution
+        The corresponding solution to the finer data instance.
+    """
+    num_depots = data.num_depots
+    routes = []
+    for route in solution.routes():
+        visits = [
+            client
+            for coarse_client in route.visits()
+            for client in clusters[coarse_client - num_depots]
+        ]
+        routes.append(Route(data, visits, route.vehicle_type()))
+
+    return Solution(data, routes)
+
+
+def solve_multilevel(
+    data: ProblemData,
+    stop: StoppingCriterion,
+    seed: int = 0,
+    collect_stats: bool = True,
+    display: bool = False,
+    params: SolveParams = SolveParams(),
+    multilevel_params: MultilevelParams = MultilevelParams(),
+) -> Result:
+    """
+    Solves the given problem data instance using a multilevel approach. The
+    instance is first coarsened level by level, by merging nearby clients
+    using :func:`~coarsen`. The coarsest instance is then solved using
+    :func:`~pyvrp.solve.solve`. Finally, the best solution is uncoarsened
+    level by level, and improved using local search at each level. This finds
+    good solutions to very large instances much faster than solving them
+    directly.
+
+    Parameters
+    ----------
+    data
+        Problem data instance to solve.
+    stop
+        Stopping criterion to use for solving the coarsest instance.
+    seed
+        Seed value to use for the random number stream. Default 0.
+    collect_stats
+        Whether to collect statistics about the solver's progress on the
+        coarsest instance. Default ``True``.
+    display
+        Whether to display information about the solver progress. Default
+        ``False``.
+    params
+        Solver parameters to use. If not provided, a default will be used.
+    multilevel_params
+        Multilevel parameters to use. If not provided, a default will be used.
+
+    Returns
+    -------
+    Result
+        A Result object, containing statistics (if collected) about solving
+        the coarsest instance, and the best found solution to the given data
+        instance.
+    """
+    start = time.perf_counter()
+
+    levels = []
+    coarse = data
+    while (
+        coarse.num_clients > multilevel_params.num_clients
+        and len(levels) < multilevel_params.max_levels
+    ):
+        next_coarse, clusters = coarsen(coarse)
+        reduction = 1 - next_coarse.num_clients / coarse.num_clients
+        if reduction < multilevel_params.min_reduction:
+            break
+
+        levels.append((coarse, clusters))
+        coarse = next_coarse
+
+    if display:
+        msg = f"Coarsened {data.num_clients} clients to {coarse.num_clients}"
+        print(f"{msg} in {len(levels)} levels.")
+
+    res = solve(coarse, stop, seed, collect_stats, display, params)
+
+    rng = RandomNumberGenerator(seed=seed)
+    cost_evaluator = PenaltyManager(params.penalty).cost_evaluator()
+    best = res.best
+
+    for fine, clusters in reversed(levels):
+        best = uncoarsen(best, fine, clusters)
+
+        neighbours = compute_neighbours(fine, params.neighbourhood)
+        ls = LocalSearch(fine, rng, neighbours, params.adaptive_operators)
+
+        for node_op in params.node_ops:
+            ls.add_node_operator(node_op(fine))
+
+        for route_op in params.route_ops:
+            ls.add_route_operator(route_op(fine))
+
+        # The local search minimises penalised cost, which may result in an
+        # infeasible solution. We only accept that if the uncoarsened solution
+        # was not feasible to begin with.
+        improved = ls(best, cost_evaluator)
+        if improved.is_feasible() or not best.is_feasible():
+            best = improved
+
+    runtime = time.perf_counter() - start
+    return Result(best, res.stats, res.num_iterations, runtime)
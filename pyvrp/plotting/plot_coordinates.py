@@ -1,7 +1,6 @@
 from typing import Optional
 
 import matplotlib.pyplot as plt
-import numpy as np
 
 from pyvrp import ProblemData
 
@@ -26,9 +25,8 @@ def plot_coordinates(
     if not ax:
         _, ax = plt.subplots()
 
-    num_locs = data.num_locations
-    x_coords = np.array([data.location(loc).x for loc in range(num_locs)])
-    y_coords = np.array([data.location(loc).y for loc in range(num_locs)])
+    x_coords = data.x()
+    y_coords = data.y()
 
     # These are the depots
     kwargs = dict(c="tab:red", marker="*", zorder=3, s=500)
@@ -27,12 +27,7 @@ def plot_time_windows(
     if not ax:
         _, ax = plt.subplots()
 
-    tw = np.array(
-        [
-            [data.location(loc).tw_early, data.location(loc).tw_late]
-            for loc in range(data.num_locations)
-        ]
-    )
+    tw = np.column_stack((data.tw_early(), data.tw_late()))
     # Lexicographic sort so for equal start we get shorter TW first
     tw = tw[np.lexsort((tw[:, 1], tw[:, 0]))]
 
@@ -1,3 +1,5 @@
+import threading
+
 from pyvrp._pyvrp import (
     CostEvaluator,
     ProblemData,
@@ -22,6 +24,18 @@ class LocalSearch:
         Random number generator.
     neighbours
         List of lists that defines the local search neighbourhood.
+    adaptive
+        Whether to select node operators adaptively. When set, each search
+        applies the node operators in order of their measured yield: the
+        improvement they found per unit of evaluation time. Node operators with
+        low yield are temporarily disabled. Default ``False``.
+
+    .. note::
+
+       Calls to the same local search object are serialised, so it is safe to
+       use from multiple threads. To search in parallel, give each thread its
+       own local search object, with its own operators and random number
+       generator. These objects can share the same problem data.
     """
 
     def __init__(
@@ -29,9 +43,12 @@ class LocalSearch:
         data: ProblemData,
         rng: RandomNumberGenerator,
         neighbours: list[list[int]],
+        adaptive: bool = False,
     ):
         self._ls = _LocalSearch(data, neighbours)
+        self._ls.set_adaptive(adaptive)
         self._rng = rng
+        self._lock = threading.Lock()
 
     def add_node_operator(self, op: NodeOperator):
         """
@@ -43,7 +60,8 @@ class LocalSearch:
         op
             The node operator to add to this local search object.
         """
-        self._ls.add_node_operator(op)
+        with self._lock:
+            self._ls.add_node_operator(op)
 
     def add_route_operator(self, op: RouteOperator):
         """
@@ -56,7 +74,8 @@ class LocalSearch:
         op
             The route operator to add to this local search object.
         """
-        self._ls.add_route_operator(op)
+        with self._lock:
+            self._ls.add_route_operator(op)
 
     def set_neighbours(self, neighbours: list[list[int]]):
         """
@@ -68,13 +87,49 @@ class LocalSearch:
         neighbours
             A new granular neighbourhood.
         """
-        self._ls.set_neighbours(neighbours)
+        with self._lock:
+            self._ls.set_neighbours(neighbours)
+
+    def set_num_active_neighbours(self, num_active_neighbours: int):
+        """
+        Sets the number of nearest neighbours of each client that the search
+        considers. This selects a prefix of each client's neighbours, so the
+        neighbour lists should be sorted by proximity. This can be used to grow
+        or shrink the neighbourhood during the search, without having to
+        recompute it.
+
+        Parameters
+        ----------
+        num_active_neighbours
+            Number of nearest neighbours to consider.
+        """
+        with self._lock:
+            self._ls.set_num_active_neighbours(num_active_neighbours)
+
+    def num_active_neighbours(self) -> int:
+        """
+        Returns the number of nearest neighbours of each client that the search
+        considers. This is at most the length of the longest neighbour list.
+        """
+        with self._lock:
+            return self._ls.num_active_neighbours()
 
     def neighbours(self) -> list[list[int]]:
         """
         Returns the granular neighbourhood currently used by the local search.
         """
-        return self._ls.neighbours()
+        with self._lock:
+            return self._ls.neighbours()
+
+    def node_operator_yields(self) -> list[float]:
+        """
+        Returns the measured yield of each node operator, in the order the
+        operators were added. Yields are only measured when node operators are
+        selected adaptively. Operators that have not been measured yet have
+        infinite yield.
+        """
+        with self._lock:
+            return self._ls.node_operator_yields()
 
     def __call__(
         self,
@@ -101,8 +156,9 @@ class LocalSearch:
             The improved solution. This is not the same object as the
             solution that was passed in.
         """
-        self._ls.shuffle(self._rng)
-        return self._ls(solution, cost_evaluator)
+        with self._lock:
+            self._ls.shuffle(self._rng)
+            return self._ls(solution, cost_evaluator)
 
     def intensify(
         self,
@@ -136,8 +192,11 @@ class LocalSearch:
             The improved solution. This is not the same object as the
             solution that was passed in.
         """
-        self._ls.shuffle(self._rng)
-        return self._ls.intensify(solution, cost_evaluator, overlap_tolerance)
+        with self._lock:
+            self._ls.shuffle(self._rng)
+            return self._ls.intensify(
+                solution, cost_evaluator, overlap_tolerance
+            )
 
     def search(
         self, solution: Solution, cost_evaluator: CostEvaluator
@@ -159,5 +218,6 @@ class LocalSearch:
             The improved solution. This is not the same object as the
             solution that was passed in.
         """
-        self._ls.shuffle(self._rng)
-        return self._ls.search(solution, cost_evaluator)
+        with self._lock:
+            self._ls.shuffle(self._rng)
+            return self._ls.search(solution, cost_evaluator)
@@ -12,12 +12,14 @@ from ._search import Exchange31 as Exchange31
 from ._search import Exchange32 as Exchange32
 from ._search import Exchange33 as Exchange33
 from ._search import NodeOperator as NodeOperator
+from ._search import OperatorPlugin as OperatorPlugin
 from ._search import RouteOperator as RouteOperator
 from ._search import SwapRoutes as SwapRoutes
 from ._search import SwapStar as SwapStar
 from ._search import SwapTails as SwapTails
 from .neighbourhood import NeighbourhoodParams as NeighbourhoodParams
 from .neighbourhood import compute_neighbours as compute_neighbours
+from .neighbourhood import fingerprint as fingerprint
 
 NODE_OPERATORS: list[Type[NodeOperator]] = [
     Exchange10,
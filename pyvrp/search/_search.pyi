@@ -34,9 +34,26 @@ class Exchange31(NodeOperator): ...
 class Exchange32(NodeOperator): ...
 class Exchange33(NodeOperator): ...
 class SwapRoutes(RouteOperator): ...
-class SwapStar(RouteOperator): ...
+class SwapStar(RouteOperator):
+    def __init__(
+        self,
+        data: ProblemData,
+        neighbours: Optional[list[list[int]]] = None,
+    ) -> None: ...
+
 class SwapTails(NodeOperator): ...
 
+class OperatorPlugin:
+    def __init__(self, path: str) -> None: ...
+    @property
+    def path(self) -> str: ...
+    def node_operators(self) -> list[str]: ...
+    def route_operators(self) -> list[str]: ...
+    def node_operator(self, name: str, data: ProblemData) -> NodeOperator: ...
+    def route_operator(
+        self, name: str, data: ProblemData
+    ) -> RouteOperator: ...
+
 class LocalSearch:
     def __init__(
         self,
@@ -45,6 +62,12 @@ class LocalSearch:
     ) -> None: ...
     def add_node_operator(self, op: NodeOperator) -> None: ...
     def add_route_operator(self, op: RouteOperator) -> None: ...
+    def set_adaptive(self, adaptive: bool) -> None: ...
+    def node_operator_yields(self) -> list[float]: ...
+    def set_num_active_neighbours(
+        self, num_active_neighbours: int
+    ) -> None: ...
+    def num_active_neighbours(self) -> int: ...
     def set_neighbours(self, neighbours: list[list[int]]) -> None: ...
     def neighbours(self) -> list[list[int]]: ...
     def __call__(
@@ -1,13 +1,22 @@
 from __future__ import annotations
 
-from dataclasses import dataclass
-from typing import TYPE_CHECKING
+import hashlib
+import os
+import tempfile
+import zipfile
+from dataclasses import astuple, dataclass
+from pathlib import Path
+from typing import TYPE_CHECKING, Optional, Union
 
 import numpy as np
 
 if TYPE_CHECKING:
     from pyvrp import ProblemData
 
+# Version of the neighbourhood cache. This should be increased whenever the
+# way neighbours are computed or stored changes, which invalidates old entries.
+_CACHE_VERSION = 2
+
 
 @dataclass
 class NeighbourhoodParams:
@@ -53,8 +62,78 @@ class NeighbourhoodParams:
             raise ValueError("nb_granular <= 0 not understood.")
 
 
+def fingerprint(data: ProblemData) -> str:
+    """
+    Computes a fingerprint of the given problem data instance. This is a hash
+    of the instance's distance and duration matrices, and of its client,
+    depot, group, and vehicle type attributes. Instances with the same
+    fingerprint are the same, apart from the names of their locations and
+    vehicle types.
+
+    Parameters
+    ----------
+    data
+        ProblemData for which to compute the fingerprint.
+
+    Returns
+    -------
+    str
+        Hexadecimal digest identifying the instance.
+    """
+    digest = hashlib.blake2b(digest_size=20)
+
+    def update(arr):
+        arr = np.ascontiguousarray(arr)
+        digest.update(f"{arr.dtype.str}{arr.shape}".encode())
+        digest.update(arr.tobytes())
+
+    update(np.array([data.num_depots, data.num_clients, data.num_profiles]))
+
+    for column in (
+        data.x(),
+        data.y(),
+        data.delivery(),
+        data.pickup(),
+        data.service_duration(),
+        data.tw_early(),
+        data.tw_late(),
+        data.release_time(),
+        data.prize(),
+        data.required(),
+        data.group_membership(),
+    ):
+        update(column)
+
+    for matrix in (*data.distance_matrices(), *data.duration_matrices()):
+        update(matrix)
+
+    for group in data.groups():
+        update(np.array([group.required, *group.clients]))
+
+    for veh_type in data.vehicle_types():
+        attrs = (
+            veh_type.num_available,
+            veh_type.depot,
+            veh_type.capacity,
+            veh_type.tw_early,
+            veh_type.tw_late,
+            veh_type.max_duration,
+            veh_type.max_distance,
+            veh_type.fixed_cost,
+            veh_type.unit_distance_cost,
+            veh_type.unit_duration_cost,
+            veh_type.profile,
+        )
+        digest.update(repr(attrs).encode())
+
+    return digest.hexdigest()
+
+
 def compute_neighbours(
-    data: ProblemData, params: NeighbourhoodParams = NeighbourhoodParams()
+    data: ProblemData,
+    params: NeighbourhoodParams = NeighbourhoodParams(),
+    cache_dir: Optional[Union[str, Path]] = None,
+    sort_by_proximity: bool = False,
 ) -> list[list[int]]:
     """
     Computes neighbours defining the neighbourhood for a problem instance.
@@ -65,6 +144,20 @@ def compute_neighbours(
         ProblemData for which to compute the neighbourhood.
     params
         NeighbourhoodParams that define how the neighbourhood is computed.
+    cache_dir
+        Optional directory in which computed neighbourhoods are cached. When
+        given, the neighbourhood is stored in this directory, keyed by the
+        instance's :func:`fingerprint` and the given ``params``. Later calls
+        for the same instance and parameters load the neighbourhood from this
+        cache rather than computing it again. The directory is created when it
+        does not yet exist. Default ``None``, which does not use a cache.
+    sort_by_proximity
+        Whether to sort symmetrised neighbour lists by proximity, closest
+        first, so that any prefix of a list contains the nearest neighbours.
+        This is needed when the search adapts the number of neighbours it
+        considers. Default ``False``, which sorts symmetrised neighbour lists
+        by client index. Neighbour lists that are not symmetrised are always
+        sorted by proximity.
 
     Returns
     -------
@@ -73,6 +166,61 @@ def compute_neighbours(
         The first lists in the lower indices are associated with the depots and
         are all empty.
     """
+    if cache_dir is None:
+        return _compute_neighbours(data, params, sort_by_proximity)
+
+    key = f"{fingerprint(data)}-{_params_key(params, sort_by_proximity)}"
+    loc = Path(cache_dir) / f"neighbours-{key}.npz"
+
+    if (neighbours := _load_neighbours(loc)) is not None:
+        return neighbours
+
+    neighbours = _compute_neighbours(data, params, sort_by_proximity)
+    _store_neighbours(loc, neighbours)
+    return neighbours
+
+
+def _params_key(params: NeighbourhoodParams, sort_by_proximity: bool) -> str:
+    key = (_CACHE_VERSION, astuple(params), sort_by_proximity)
+    key = repr(key).encode()
+    return hashlib.blake2b(key, digest_size=8).hexdigest()
+
+
+def _load_neighbours(loc: Path) -> Optional[list[list[int]]]:
+    try:
+        with np.load(loc, allow_pickle=False) as cached:
+            offsets = cached["offsets"].tolist()
+            flat = cached["neighbours"].tolist()
+    except (OSError, KeyError, ValueError, zipfile.BadZipFile):
+        return None  # missing or unreadable; neighbours are recomputed
+
+    return [flat[start:end] for start, end in zip(offsets, offsets[1:])]
+
+
+def _store_neighbours(loc: Path, neighbours: list[list[int]]):
+    offsets = np.cumsum([0, *map(len, neighbours)], dtype=np.int64)
+    flat = np.fromiter(
+        (client for clients in neighbours for client in clients),
+        dtype=np.int64,
+        count=offsets[-1],
+    )
+
+    # We first write to a temporary file, and then move it into place. That
+    # ensures concurrent solves never read a partially written cache entry.
+    loc.parent.mkdir(parents=True, exist_ok=True)
+    fd, tmp = tempfile.mkstemp(dir=loc.parent, suffix=".tmp")
+    try:
+        with os.fdopen(fd, "wb") as fh:
+            np.savez(fh, offsets=offsets, neighbours=flat)
+        os.replace(tmp, loc)
+    except BaseException:
+        os.unlink(tmp)
+        raise
+
+
+def _compute_neighbours(
+    data: ProblemData, params: NeighbourhoodParams, sort_by_proximity: bool
+) -> list[list[int]]:
     proximity = _compute_proximity(
         data,
         params.weight_wait_time,
@@ -109,7 +257,18 @@ def compute_neighbours(
     adj[rows, top_k] = True
     adj = adj | adj.transpose()
 
-    return [np.flatnonzero(row).tolist() for row in adj]
+    if not sort_by_proximity:
+        return [np.flatnonzero(row).tolist() for row in adj]
+
+    # The adjacent clients are sorted by proximity, so that any prefix of a
+    # client's neighbours contains its closest neighbours.
+    neighbours = []
+    for client, row in enumerate(adj):
+        adjacent = np.flatnonzero(row)
+        order = np.argsort(proximity[client, adjacent], kind="stable")
+        neighbours.append(adjacent[order].tolist())
+
+    return neighbours
 
 
 def _compute_proximity(
@@ -139,16 +298,10 @@ def _compute_proximity(
            large class of vehicle routing problems with time-windows.
            *Computers & Operations Research*, 40(1), 475 - 489.
     """
-    clients = [data.location(loc) for loc in range(data.num_locations)]
-
-    early = np.asarray([c.tw_early for c in clients])
-    late = np.asarray([c.tw_late for c in clients])
-
-    service = np.zeros_like(early)
-    service[data.num_depots :] = [c.service_duration for c in data.clients()]
-
-    prize = np.zeros_like(early)
-    prize[data.num_depots :] = [client.prize for client in data.clients()]
+    early = data.tw_early()
+    late = data.tw_late()
+    service = data.service_duration()
+    prize = data.prize()
 
     # We first determine the elementwise minimum cost across all vehicle types.
     # This is the cheapest way any edge can be traversed.
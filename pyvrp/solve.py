@@ -1,6 +1,6 @@
 from __future__ import annotations
 
-from typing import TYPE_CHECKING, Type, Union
+from typing import TYPE_CHECKING, Optional, Type, Union
 
 import tomli
 
@@ -47,6 +47,16 @@ class SolveParams:
         Node operators to use in the search.
     route_ops
         Route operators to use in the search.
+    adaptive_operators
+        Whether the search selects node operators adaptively, based on their
+        measured yield. See :class:`~pyvrp.search.LocalSearch.LocalSearch`.
+        Default ``False``.
+    neighbourhood_cache
+        Optional directory in which to cache computed neighbourhoods, so that
+        repeated solves of the same instance do not need to compute the
+        neighbourhood again. See
+        :func:`~pyvrp.search.neighbourhood.compute_neighbours`. Default
+        ``None``, which does not use a cache.
     """
 
     def __init__(
@@ -57,6 +67,8 @@ class SolveParams:
         neighbourhood: NeighbourhoodParams = NeighbourhoodParams(),
         node_ops: list[Type[NodeOperator]] = NODE_OPERATORS,
         route_ops: list[Type[RouteOperator]] = ROUTE_OPERATORS,
+        adaptive_operators: bool = False,
+        neighbourhood_cache: Optional[Union[str, pathlib.Path]] = None,
     ):
         self._genetic = genetic
         self._penalty = penalty
@@ -64,6 +76,8 @@ class SolveParams:
         self._neighbourhood = neighbourhood
         self._node_ops = node_ops
         self._route_ops = route_ops
+        self._adaptive_operators = adaptive_operators
+        self._neighbourhood_cache = neighbourhood_cache
 
     def __eq__(self, other: object) -> bool:
         return (
@@ -74,6 +88,8 @@ class SolveParams:
             and self.neighbourhood == other.neighbourhood
             and self.node_ops == other.node_ops
             and self.route_ops == other.route_ops
+            and self.adaptive_operators == other.adaptive_operators
+            and self.neighbourhood_cache == other.neighbourhood_cache
         )
 
     @property
@@ -100,6 +116,44 @@ class SolveParams:
     def route_ops(self):
         return self._route_ops
 
+    @property
+    def adaptive_operators(self):
+        return self._adaptive_operators
+
+    @property
+    def neighbourhood_cache(self):
+        return self._neighbourhood_cache
+
+    def replace(
+        self,
+        genetic: Optional[GeneticAlgorithmParams] = None,
+        penalty: Optional[PenaltyParams] = None,
+        population: Optional[PopulationParams] = None,
+        neighbourhood: Optional[NeighbourhoodParams] = None,
+        node_ops: Optional[list[Type[NodeOperator]]] = None,
+        route_ops: Optional[list[Type[RouteOperator]]] = None,
+        adaptive_operators: Optional[bool] = None,
+        neighbourhood_cache: Optional[Union[str, pathlib.Path]] = None,
+    ) -> SolveParams:
+        """
+        Returns a new SolveParams instance with the same parameters as this
+        one, except for those arguments that are explicitly passed.
+        """
+
+        def pick(new, old):
+            return old if new is None else new
+
+        return SolveParams(
+            pick(genetic, self.genetic),
+            pick(penalty, self.penalty),
+            pick(population, self.population),
+            pick(neighbourhood, self.neighbourhood),
+            pick(node_ops, self.node_ops),
+            pick(route_ops, self.route_ops),
+            pick(adaptive_operators, self.adaptive_operators),
+            pick(neighbourhood_cache, self.neighbourhood_cache),
+        )
+
     @classmethod
     def from_file(cls, loc: Union[str, pathlib.Path]):
         """
@@ -122,7 +176,14 @@ class SolveParams:
             route_ops = [getattr(pyvrp.search, op) for op in data["route_ops"]]
 
         return cls(
-            gen_params, pen_params, pop_params, nb_params, node_ops, route_ops
+            gen_params,
+            pen_params,
+            pop_params,
+            nb_params,
+            node_ops,
+            route_ops,
+            data.get("adaptive_operators", False),
+            data.get("neighbourhood_cache"),
         )
 
 
@@ -162,8 +223,13 @@ def solve(
         found solution.
     """
     rng = RandomNumberGenerator(seed=seed)
-    neighbours = compute_neighbours(data, params.neighbourhood)
-    ls = LocalSearch(data, rng, neighbours)
+    neighbours = compute_neighbours(
+        data,
+        params.neighbourhood,
+        params.neighbourhood_cache,
+        sort_by_proximity=params.genetic.nb_iter_granular > 0,
+    )
+    ls = LocalSearch(data, rng, neighbours, params.adaptive_operators)
 
     for node_op in params.node_ops:
         ls.add_node_operator(node_op(data))
@@ -0,0 +1,29 @@
+class MaxGap:
+    """
+    Criterion that stops once the best solution is provably close to optimal:
+    when the relative gap between the best cost and a lower bound on the cost
+    of any solution is at most a given threshold. A lower bound can be computed
+    using :func:`~pyvrp._pyvrp.lower_bound`.
+
+    Parameters
+    ----------
+    lower_bound
+        Lower bound on the cost of any feasible solution.
+    max_gap
+        Maximum relative gap, as a fraction of the best cost. For example,
+        ``0.01`` stops once the best cost is within 1% of the lower bound.
+    """
+
+    def __init__(self, lower_bound: float, max_gap: float):
+        if max_gap < 0:
+            raise ValueError("max_gap < 0 not understood.")
+
+        self._lower_bound = lower_bound
+        self._max_gap = max_gap
+
+    def __call__(self, best_cost: float) -> bool:
+        if best_cost <= self._lower_bound:
+            return True
+
+        gap = (best_cost - self._lower_bound) / abs(best_cost)
+        return gap <= self._max_gap
@@ -1,3 +1,4 @@
+from .MaxGap import MaxGap as MaxGap
 from .MaxIterations import MaxIterations as MaxIterations
 from .MaxRuntime import MaxRuntime as MaxRuntime
 from .MultipleCriteria import MultipleCriteria as MultipleCriteria
@@ -1,23 +1,30 @@
-from numpy.testing import assert_equal, assert_raises
+from numpy.testing import assert_, assert_equal, assert_raises
 
 from pyvrp import CostEvaluator, RandomNumberGenerator, Solution, VehicleType
 from pyvrp.crossover import ordered_crossover as ox
 from pyvrp.crossover._crossover import ordered_crossover as cpp_ox
+from pyvrp.crossover._crossover import (
+    ordered_split_crossover as cpp_split_ox,
+)
 
 
-def test_raises_when_not_tsp(ok_small):
+def test_raises_when_multiple_vehicle_types(ok_small):
     """
     Tests that the ordered crossover (OX) operator raises when used on a data
-    instance that is not a TSP.
+    instance with a heterogeneous fleet.
     """
     cost_eval = CostEvaluator(20, 6, 0)
     rng = RandomNumberGenerator(seed=42)
-    sol = Solution(ok_small, [[1, 2], [3, 4]])
 
-    # This is not a TSP, and thus OX should raise
-    assert_equal(ok_small.num_vehicles, 3)
+    data = ok_small.replace(
+        vehicle_types=[VehicleType(2, capacity=10), VehicleType(capacity=5)]
+    )
+    sol = Solution(data, [[1, 2], [3, 4]])
+
+    # There are two vehicle types, and thus OX should raise.
+    assert_equal(data.num_vehicle_types, 2)
     with assert_raises(ValueError):
-        ox((sol, sol), ok_small, cost_eval, rng)
+        ox((sol, sol), data, cost_eval, rng)
 
 
 def test_edge_cases_return_parents(pr107):
@@ -106,3 +113,38 @@ def test_wrap_around(ok_small):
     route = offspring.routes()[0]
     assert_equal(offspring.num_clients(), 4)
     assert_equal(route.visits(), [1, 2, 3, 4])
+
+
+def test_split_crossover_giant_tours(ok_small):
+    """
+    Tests that OX on instances with multiple vehicles crosses the giant tours
+    of both parents, and splits the offspring tour into routes.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    sol1 = Solution(ok_small, [[1, 2], [3, 4]])
+    sol2 = Solution(ok_small, [[4], [3, 2, 1]])
+
+    # From the giant tour [1, 2, 3, 4] of the first parent we take [1, 2]. The
+    # giant tour of the second parent is [4, 3, 2, 1], from which we then get
+    # [4, 3]. The offspring's routes should visit [1, 2, 4, 3] in that order.
+    offspring = cpp_split_ox((sol1, sol2), ok_small, cost_eval, (0, 2))
+    visits = [client for route in offspring.routes() for client in route]
+    assert_equal(visits, [1, 2, 4, 3])
+    assert_(offspring.num_routes() <= ok_small.num_vehicles)
+
+
+def test_multiple_vehicles_offspring_is_complete(rc208):
+    """
+    Tests that OX produces offspring that visit all clients, using no more
+    routes than there are vehicles, when the instance has multiple vehicles.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+
+    for _ in range(10):
+        sol1 = Solution.make_random(rc208, rng)
+        sol2 = Solution.make_random(rc208, rng)
+
+        offspring = ox((sol1, sol2), rc208, cost_eval, rng)
+        assert_equal(offspring.num_clients(), rc208.num_clients)
+        assert_(offspring.num_routes() <= rc208.num_vehicles)
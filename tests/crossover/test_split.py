@@ -0,0 +1,95 @@
+import itertools
+
+from numpy.testing import assert_, assert_equal, assert_raises
+from pytest import mark
+
+from pyvrp import CostEvaluator, Solution, VehicleType
+from pyvrp.crossover._crossover import split
+
+
+def _best_split_cost(tour, data, cost_evaluator) -> int:
+    """
+    Computes the optimal split cost of the given tour by enumerating all ways
+    to cut the tour into routes.
+    """
+    best = None
+    for num_cuts in range(min(len(tour), data.num_vehicles)):
+        for cuts in itertools.combinations(range(1, len(tour)), num_cuts):
+            bounds = [0, *cuts, len(tour)]
+            routes = [tour[i:j] for i, j in zip(bounds, bounds[1:])]
+            cost = cost_evaluator.penalised_cost(Solution(data, routes))
+            best = cost if best is None else min(best, cost)
+
+    return best
+
+
+@mark.parametrize("tour", [[1, 2, 3, 4], [4, 3, 2, 1], [2, 4, 1, 3]])
+def test_split_is_optimal(ok_small, tour: list[int]):
+    """
+    Tests that split finds the best way to split a giant tour into routes on a
+    small instance with time windows.
+    """
+    cost_evaluator = CostEvaluator(20, 6, 0)
+    sol = split(tour, ok_small, cost_evaluator)
+
+    visits = [client for route in sol.routes() for client in route]
+    assert_equal(visits, tour)
+
+    best = _best_split_cost(tour, ok_small, cost_evaluator)
+    assert_equal(cost_evaluator.penalised_cost(sol), best)
+
+
+@mark.parametrize("load_penalty", [0, 1, 20, 1_000])
+def test_split_is_optimal_cvrp(small_cvrp, load_penalty: int):
+    """
+    Tests that split finds the best way to split a giant tour into routes on a
+    capacitated instance, where the linear-time split algorithm applies.
+    """
+    cost_evaluator = CostEvaluator(load_penalty, 6, 0)
+    tour = [5, 3, 9, 1, 7, 2, 8, 4, 6]
+    sol = split(tour, small_cvrp, cost_evaluator)
+
+    visits = [client for route in sol.routes() for client in route]
+    assert_equal(visits, tour)
+
+    best = _best_split_cost(tour, small_cvrp, cost_evaluator)
+    assert_equal(cost_evaluator.penalised_cost(sol), best)
+
+
+def test_split_respects_number_of_vehicles(ok_small):
+    """
+    Tests that split never uses more routes than there are vehicles, even when
+    that results in excess load.
+    """
+    data = ok_small.replace(vehicle_types=[VehicleType(capacity=10)])
+    sol = split([1, 2, 3, 4], data, CostEvaluator(1_000, 6, 0))
+
+    assert_equal(sol.num_routes(), 1)
+    assert_(sol.excess_load() > 0)
+
+
+def test_split_empty_tour(ok_small):
+    """
+    Tests that splitting an empty tour results in an empty solution.
+    """
+    sol = split([], ok_small, CostEvaluator(20, 6, 0))
+    assert_equal(sol.num_routes(), 0)
+    assert_equal(sol.num_clients(), 0)
+
+
+def test_split_raises_for_invalid_arguments(ok_small):
+    """
+    Tests that split raises when the tour contains depots or unknown clients,
+    and when the instance has more than one vehicle type.
+    """
+    cost_evaluator = CostEvaluator(20, 6, 0)
+
+    with assert_raises(ValueError):  # depot is not a client
+        split([0, 1, 2], ok_small, cost_evaluator)
+
+    with assert_raises(ValueError):  # there is no client 5
+        split([1, 2, 5], ok_small, cost_evaluator)
+
+    data = ok_small.replace(vehicle_types=[VehicleType(), VehicleType()])
+    with assert_raises(ValueError):
+        split([1, 2, 3, 4], data, cost_evaluator)
@@ -0,0 +1,18 @@
+// Example operator plugin, used by the tests in test_OperatorPlugin.py. It
+// provides PyVRP's own relocate (Exchange10) and route swap (SwapRoutes)
+// operators under different names. These operators use functions that are
+// defined in PyVRP's source files, so those are compiled into the plugin:
+//
+//    c++ -std=c++20 -shared -fPIC -I pyvrp/cpp relocate.cpp \
+//        pyvrp/cpp/ProblemData.cpp pyvrp/cpp/DistanceSegment.cpp \
+//        pyvrp/cpp/search/Route.cpp pyvrp/cpp/search/SwapRoutes.cpp \
+//        pyvrp/cpp/search/SwapTails.cpp -o relocate.so
+#include "search/Exchange.h"
+#include "search/OperatorRegistry.h"
+#include "search/SwapRoutes.h"
+
+PYVRP_REGISTER_OPERATORS(registry)
+{
+    registry.addNodeOperator<pyvrp::search::Exchange<1, 0>>("Relocate");
+    registry.addRouteOperator<pyvrp::search::SwapRoutes>("Swap");
+}
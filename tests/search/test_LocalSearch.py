@@ -515,3 +515,77 @@ def test_swap_if_improving_mutually_exclusive_group(
     routes = improved.routes()
     assert_equal(improved.num_routes(), 1)
     assert_equal(routes[0].visits(), [3, 4])
+
+
+def test_adaptive_operator_selection_measures_yields(rc208):
+    """
+    Tests that adaptive operator selection measures the yield of each node
+    operator, and that the local search still improves solutions when some
+    operators are temporarily disabled.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    neighbours = compute_neighbours(rc208)
+
+    ls = LocalSearch(rc208, rng, neighbours, adaptive=True)
+    ls.add_node_operator(Exchange10(rc208))
+    ls.add_node_operator(Exchange11(rc208))
+
+    # Operators that have not been measured yet have infinite yield.
+    assert_equal(ls.node_operator_yields(), [np.inf, np.inf])
+
+    cost_eval = CostEvaluator(20, 6, 0)
+    for _ in range(5):
+        sol = Solution.make_random(rc208, rng)
+        improved = ls.search(sol, cost_eval)
+        assert_(improved.is_complete())
+        assert_(
+            cost_eval.penalised_cost(improved) < cost_eval.penalised_cost(sol)
+        )
+
+    yields = ls.node_operator_yields()
+    assert_equal(len(yields), 2)
+    assert_(all(0 <= value < np.inf for value in yields))
+
+
+def test_adaptive_operator_selection_is_optional(rc208):
+    """
+    Tests that node operator yields are not measured without adaptive operator
+    selection.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    ls = LocalSearch(rc208, rng, compute_neighbours(rc208))
+    ls.add_node_operator(Exchange10(rc208))
+
+    sol = Solution.make_random(rc208, rng)
+    ls.search(sol, CostEvaluator(20, 6, 0))
+    assert_equal(ls.node_operator_yields(), [np.inf])
+
+
+def test_num_active_neighbours(rc208):
+    """
+    Tests that the number of active neighbours defaults to the longest
+    neighbour list, and that restricting it to zero turns the search into a
+    no-op, like an empty neighbourhood would.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    params = NeighbourhoodParams(nb_granular=20)
+    ls = LocalSearch(rc208, rng, compute_neighbours(rc208, params))
+    ls.add_node_operator(Exchange10(rc208))
+    assert_equal(ls.num_active_neighbours(), 20)
+
+    ls.set_num_active_neighbours(100)  # is capped at the longest list
+    assert_equal(ls.num_active_neighbours(), 20)
+
+    ls.set_num_active_neighbours(0)
+    assert_equal(ls.num_active_neighbours(), 0)
+
+    cost_eval = CostEvaluator(20, 6, 0)
+    sol = Solution.make_random(rc208, rng)
+    assert_equal(ls.search(sol, cost_eval), sol)
+
+    # With a few active neighbours the search improves again. The neighbour
+    # lists themselves are not changed by restricting the active prefix.
+    ls.set_num_active_neighbours(5)
+    improved = ls.search(sol, cost_eval)
+    assert_(cost_eval.penalised_cost(improved) < cost_eval.penalised_cost(sol))
+    assert_(all(len(neighbours) == 20 for neighbours in ls.neighbours()[1:]))
@@ -0,0 +1,129 @@
+import shutil
+import subprocess
+import sys
+from pathlib import Path
+
+import pytest
+from numpy.testing import assert_, assert_equal, assert_raises
+
+import pyvrp
+from pyvrp import CostEvaluator, RandomNumberGenerator, Solution
+from pyvrp.search import (
+    Exchange10,
+    LocalSearch,
+    NodeOperator,
+    OperatorPlugin,
+    RouteOperator,
+    compute_neighbours,
+)
+from pyvrp.search import _search as search_ext
+
+_CPP_DIR = Path(pyvrp.__file__).parent / "cpp"
+_PLUGIN_SOURCES = [
+    Path(__file__).parent / "plugin" / "relocate.cpp",
+    _CPP_DIR / "ProblemData.cpp",
+    _CPP_DIR / "DistanceSegment.cpp",
+    _CPP_DIR / "search" / "Route.cpp",
+    _CPP_DIR / "search" / "SwapRoutes.cpp",
+    _CPP_DIR / "search" / "SwapTails.cpp",
+]
+
+
+@pytest.fixture(scope="module")
+def plugin(tmp_path_factory) -> OperatorPlugin:
+    """
+    Fixture that compiles the example plugin, and loads it. The plugin is
+    compiled with and without time windows, whichever matches the extension.
+    """
+    compiler = shutil.which("c++")
+    if compiler is None or sys.platform == "win32":
+        pytest.skip("No compiler available to build the plugin.")
+
+    tmp_dir = tmp_path_factory.mktemp("plugin")
+    for defines in ([], ["-DPYVRP_NO_TIME_WINDOWS"]):
+        loc = tmp_dir / f"relocate{len(defines)}.so"
+        cmd = [compiler, "-std=c++20", "-shared", "-fPIC", *defines]
+        cmd += ["-I", str(_CPP_DIR), *map(str, _PLUGIN_SOURCES)]
+        cmd += ["-o", str(loc)]
+
+        if subprocess.run(cmd, capture_output=True).returncode != 0:
+            pytest.skip("Could not compile the plugin.")
+
+        try:
+            return OperatorPlugin(str(loc))
+        except ValueError:  # compiled for the other problem type
+            continue
+
+    pytest.fail("Plugin does not match the extension.")
+
+
+def test_plugin_provides_registered_operators(
+    plugin: OperatorPlugin, ok_small
+):
+    """
+    Tests that the plugin lists the operators it registered, and creates
+    instances of those operators.
+    """
+    assert_equal(plugin.node_operators(), ["Relocate"])
+    assert_equal(plugin.route_operators(), ["Swap"])
+
+    node_op = plugin.node_operator("Relocate", ok_small)
+    assert_(isinstance(node_op, NodeOperator))
+
+    route_op = plugin.route_operator("Swap", ok_small)
+    assert_(isinstance(route_op, RouteOperator))
+
+
+def test_unknown_operator_raises(plugin: OperatorPlugin, ok_small):
+    """
+    Tests that asking for an operator the plugin does not provide raises.
+    """
+    with assert_raises(ValueError):
+        plugin.node_operator("Swap", ok_small)  # is a route operator
+
+    with assert_raises(ValueError):
+        plugin.route_operator("Relocate", ok_small)  # is a node operator
+
+
+def test_plugin_operator_same_as_builtin(plugin: OperatorPlugin, rc208):
+    """
+    Tests that the local search finds the same solution with the plugin's
+    relocate operator as with PyVRP's own relocate operator.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    sol = Solution.make_random(rc208, RandomNumberGenerator(seed=1))
+    neighbours = compute_neighbours(rc208)
+
+    improved = []
+    for op in [plugin.node_operator("Relocate", rc208), Exchange10(rc208)]:
+        ls = LocalSearch(rc208, RandomNumberGenerator(seed=2), neighbours)
+        ls.add_node_operator(op)
+        improved.append(ls.search(sol, cost_eval))
+
+    assert_equal(improved[0], improved[1])
+    cost = cost_eval.penalised_cost(improved[0])
+    assert_(cost < cost_eval.penalised_cost(sol))
+
+
+def test_operator_outlives_plugin(plugin: OperatorPlugin, ok_small):
+    """
+    Tests that operators keep their plugin loaded, even when the plugin object
+    itself is no longer referenced.
+    """
+    op = OperatorPlugin(plugin.path).node_operator("Relocate", ok_small)
+
+    ls = LocalSearch(ok_small, RandomNumberGenerator(seed=42), [[]] * 5)
+    ls.add_node_operator(op)
+    ls(Solution(ok_small, [[1, 2], [3, 4]]), CostEvaluator(20, 6, 0))
+
+
+def test_load_raises_for_non_plugins(tmp_path: Path):
+    """
+    Tests that loading a file that does not exist, or a shared library that is
+    not an operator plugin, raises.
+    """
+    with assert_raises(RuntimeError):
+        OperatorPlugin(str(tmp_path / "missing.so"))
+
+    with assert_raises(RuntimeError):  # a shared library, but not a plugin
+        OperatorPlugin(search_ext.__file__)
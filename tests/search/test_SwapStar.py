@@ -1,5 +1,5 @@
 import numpy as np
-from numpy.testing import assert_, assert_equal
+from numpy.testing import assert_, assert_equal, assert_raises
 from pytest import mark
 
 from pyvrp import (
@@ -136,6 +136,86 @@ def test_swap_star_can_swap_in_place():
     assert_(nodes[3].route is route1)
 
 
+@mark.parametrize(
+    ("neighbours", "expected"),
+    [
+        ([[], [], [1], []], 0),  # no neighbours in the other route
+        ([[], [3], [], []], -9),  # 3 is a neighbour of 1
+        ([[], [], [], [1]], -9),  # 1 is a neighbour of 3, which also works
+    ],
+)
+def test_swap_star_restricted_to_neighbours(
+    neighbours: list[list[int]], expected: int
+):
+    """
+    Tests that SWAP* only evaluates pairs of clients that are neighbours when
+    a neighbourhood is given, in either direction.
+    """
+    data = ProblemData(
+        clients=[Client(x=1, y=1), Client(x=2, y=2), Client(x=3, y=3)],
+        depots=[Depot(x=0, y=0)],
+        vehicle_types=[VehicleType(num_available=2)],
+        distance_matrices=[
+            np.asarray(
+                [
+                    [0, 1, 10, 10],
+                    [1, 0, 10, 10],
+                    [10, 10, 0, 10],
+                    [10, 10, 1, 0],
+                ]
+            ),
+        ],
+        duration_matrices=[np.zeros((4, 4), dtype=int)],
+    )
+
+    route1 = Route(data, idx=0, vehicle_type=0)
+    route1.append(Node(loc=1))
+    route1.append(Node(loc=2))
+    route1.update()
+
+    route2 = Route(data, idx=1, vehicle_type=0)
+    route2.append(Node(loc=3))
+    route2.update()
+
+    # The only improving move exchanges clients 1 and 3, which is only found
+    # when these clients are neighbours. See also the in place test above.
+    swap_star = SwapStar(data, neighbours)
+    cost_eval = CostEvaluator(1, 1, 0)
+    assert_equal(swap_star.evaluate(route1, route2, cost_eval), expected)
+
+
+def test_swap_star_full_neighbourhood_same_as_all_pairs(rc208):
+    """
+    Tests that restricting SWAP* to a neighbourhood that contains all clients
+    results in the same search as evaluating all pairs of clients.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+    nb_params = NeighbourhoodParams(nb_granular=rc208.num_clients)
+    neighbours = compute_neighbours(rc208, nb_params)
+
+    route = list(range(rc208.num_depots, rc208.num_locations))
+    sol = Solution(rc208, [route[:50], route[50:]])
+
+    improved = []
+    for swap_star in [SwapStar(rc208), SwapStar(rc208, neighbours)]:
+        ls = LocalSearch(rc208, RandomNumberGenerator(seed=1), neighbours)
+        ls.add_route_operator(swap_star)
+        improved.append(ls.intensify(sol, cost_eval, overlap_tolerance=1))
+
+    assert_equal(improved[0], improved[1])
+
+
+def test_swap_star_raises_neighbourhood_dimensions(ok_small):
+    """
+    Tests that SWAP* raises when the neighbourhood does not match the data.
+    """
+    with assert_raises(RuntimeError):  # one location short
+        SwapStar(ok_small, [[] for _ in range(ok_small.num_locations - 1)])
+
+    with assert_raises(RuntimeError):  # location 5 does not exist
+        SwapStar(ok_small, [[], [5], [], [], []])
+
+
 def test_wrong_load_calculation_bug():
     """
     This test exercises the bug identified in issue #344 (here:
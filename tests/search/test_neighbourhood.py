@@ -2,8 +2,8 @@ import numpy as np
 from numpy.testing import assert_, assert_equal, assert_raises
 from pytest import mark
 
-from pyvrp import VehicleType
-from pyvrp.search import NeighbourhoodParams, compute_neighbours
+from pyvrp import Client, VehicleType
+from pyvrp.search import NeighbourhoodParams, compute_neighbours, fingerprint
 
 
 @mark.parametrize(
@@ -268,3 +268,90 @@ def test_multiple_routing_profiles(ok_small):
     # neighbourhood computations, resulting in the same neighbourhood as with
     # the original (unchanged) data.
     assert_equal(compute_neighbours(data), compute_neighbours(ok_small))
+
+
+def test_fingerprint(ok_small):
+    """
+    Tests that the fingerprint identifies an instance by its contents: equal
+    instances have the same fingerprint, but changing the matrices, clients,
+    or vehicle types changes the fingerprint.
+    """
+    assert_equal(fingerprint(ok_small), fingerprint(ok_small.replace()))
+
+    distances = ok_small.distance_matrix(profile=0).copy()
+    distances[1, 2] += 1
+    other = ok_small.replace(distance_matrices=[distances])
+    assert_(fingerprint(other) != fingerprint(ok_small))
+
+    clients = ok_small.clients()
+    clients[0] = Client(x=clients[0].x, y=clients[0].y, prize=1)
+    other = ok_small.replace(clients=clients)
+    assert_(fingerprint(other) != fingerprint(ok_small))
+
+    other = ok_small.replace(vehicle_types=[VehicleType(3, capacity=11)])
+    assert_(fingerprint(other) != fingerprint(ok_small))
+
+
+def test_neighbourhood_cache(rc208, tmp_path):
+    """
+    Tests that neighbourhoods are cached per instance and parameter set, and
+    that cached neighbourhoods are the same as freshly computed ones.
+    """
+    cache_dir = tmp_path / "cache"
+    params = NeighbourhoodParams(nb_granular=10)
+    neighbours = compute_neighbours(rc208, params)
+
+    assert_equal(compute_neighbours(rc208, params, cache_dir), neighbours)
+    assert_equal(len(list(cache_dir.iterdir())), 1)
+
+    # The second call loads the neighbourhood from the cache.
+    assert_equal(compute_neighbours(rc208, params, cache_dir), neighbours)
+    assert_equal(len(list(cache_dir.iterdir())), 1)
+
+    # Different parameters result in a different cache entry.
+    other = NeighbourhoodParams(nb_granular=10, symmetric_neighbours=True)
+    assert_equal(
+        compute_neighbours(rc208, other, cache_dir),
+        compute_neighbours(rc208, other),
+    )
+    assert_equal(len(list(cache_dir.iterdir())), 2)
+
+
+def test_neighbourhood_cache_recomputes_unreadable_entries(ok_small, tmp_path):
+    """
+    Tests that a corrupted cache entry is ignored and replaced, rather than
+    raising.
+    """
+    neighbours = compute_neighbours(ok_small, cache_dir=tmp_path)
+    (entry,) = tmp_path.iterdir()
+    entry.write_bytes(b"not a neighbourhood")
+
+    assert_equal(compute_neighbours(ok_small, cache_dir=tmp_path), neighbours)
+    assert_equal(compute_neighbours(ok_small, cache_dir=tmp_path), neighbours)
+
+
+def test_symmetric_neighbours_sort_by_proximity(rc208):
+    """
+    Tests that symmetrised neighbour lists are sorted by client index by
+    default, and by proximity when ``sort_by_proximity`` is set. Both contain
+    the same neighbours.
+    """
+    params = NeighbourhoodParams(
+        weight_wait_time=0,
+        weight_time_warp=0,
+        symmetric_proximity=False,
+        symmetric_neighbours=True,
+    )
+
+    by_index = compute_neighbours(rc208, params)
+    by_proximity = compute_neighbours(rc208, params, sort_by_proximity=True)
+    distances = rc208.distance_matrix(profile=0)
+
+    for client in range(rc208.num_depots, rc208.num_locations):
+        assert_equal(by_index[client], sorted(by_index[client]))
+        assert_equal(set(by_proximity[client]), set(by_index[client]))
+
+        # Proximity is completely based on distance here, so the proximity
+        # ordered neighbours should have non-decreasing distances.
+        dists = distances[client, by_proximity[client]]
+        assert_(np.all(np.diff(dists) >= 0))
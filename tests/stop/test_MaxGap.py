@@ -0,0 +1,46 @@
+from numpy.testing import assert_, assert_raises
+from pytest import mark
+
+from pyvrp.stop import MaxGap
+
+
+@mark.parametrize("max_gap", [-0.1, -1, -100])
+def test_raise_negative_parameters(max_gap: float):
+    """
+    max_gap cannot be negative.
+    """
+    with assert_raises(ValueError):
+        MaxGap(100, max_gap)
+
+
+def test_stops_when_gap_below_threshold():
+    """
+    Tests that the criterion stops exactly when the relative gap between the
+    best cost and the lower bound is at most the given threshold.
+    """
+    stop = MaxGap(90, 0.1)
+
+    assert_(not stop(float("inf")))  # no feasible solution yet
+    assert_(not stop(101))
+    assert_(stop(100))  # gap is exactly 10%
+    assert_(stop(95))
+
+
+def test_zero_max_gap():
+    """
+    Tests that a zero maximum gap only stops once the best cost is equal to the
+    lower bound.
+    """
+    stop = MaxGap(100, 0)
+
+    assert_(not stop(101))
+    assert_(stop(100))
+
+
+def test_stops_when_cost_is_below_bound():
+    """
+    Tests that the criterion also stops when the best cost is at or below the
+    bound, which happens for example with zero-cost solutions.
+    """
+    assert_(MaxGap(0, 0)(0))
+    assert_(MaxGap(10, 0.01)(5))
@@ -60,6 +60,48 @@ def test_params_constructor_does_not_raise_when_arguments_valid(
     assert_equal(params.nb_iter_no_improvement, nb_iter_no_improvement)
 
 
+@mark.parametrize(
+    ("nb_iter_route_pool", "route_pool_time_limit"),
+    [
+        (-1, 0.1),  # nb_iter_route_pool < 0
+        (1, -0.1),  # route_pool_time_limit < 0
+    ],
+)
+def test_params_raises_when_route_pool_arguments_invalid(
+    nb_iter_route_pool: int,
+    route_pool_time_limit: float,
+):
+    """
+    Tests that invalid route pool configurations are not accepted.
+    """
+    with assert_raises(ValueError):
+        GeneticAlgorithmParams(
+            nb_iter_route_pool=nb_iter_route_pool,
+            route_pool_time_limit=route_pool_time_limit,
+        )
+
+
+@mark.parametrize(
+    ("nb_iter_granular", "min_granular"),
+    [
+        (-1, 10),  # nb_iter_granular < 0
+        (10, 0),  # min_granular <= 0
+    ],
+)
+def test_params_raises_when_granular_arguments_invalid(
+    nb_iter_granular: int,
+    min_granular: int,
+):
+    """
+    Tests that invalid granular neighbourhood configurations are not accepted.
+    """
+    with assert_raises(ValueError):
+        GeneticAlgorithmParams(
+            nb_iter_granular=nb_iter_granular,
+            min_granular=min_granular,
+        )
+
+
 def test_raises_when_no_initial_solutions(rc208):
     """
     Tests that GeneticAlgorithm raises when no initial solutions are provided,
@@ -258,3 +300,64 @@ def test_never_repairs_when_zero_repair_probability(rc208):
     ga_params = GeneticAlgorithmParams(repair_probability=0.0)
     algo = GeneticAlgorithm(rc208, pm, rng, pop, ls, srex, init, ga_params)
     algo.run(MaxIterations(50))
+
+
+def test_route_pool_recombination(rc208):
+    """
+    Smoke test that checks the genetic algorithm runs with the route pool
+    enabled, and that the best solution it finds is feasible.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    pm = PenaltyManager()
+    pop = Population(bpd)
+    init = [Solution.make_random(rc208, rng) for _ in range(25)]
+
+    ls = LocalSearch(rc208, rng, compute_neighbours(rc208))
+    ls.add_node_operator(Exchange10(rc208))
+
+    params = GeneticAlgorithmParams(nb_iter_route_pool=10)
+    algo = GeneticAlgorithm(rc208, pm, rng, pop, ls, srex, init, params)
+    result = algo.run(MaxIterations(50))
+
+    assert_(result.best.is_feasible())
+
+
+def test_adaptive_granular_neighbourhood(rc208):
+    """
+    Tests that the genetic algorithm runs when adapting the size of the
+    granular neighbourhood, and that the search's full neighbourhood is
+    restored afterwards.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    pm = PenaltyManager()
+    pop = Population(bpd)
+    init = [Solution.make_random(rc208, rng) for _ in range(25)]
+
+    ls = LocalSearch(rc208, rng, compute_neighbours(rc208))
+    ls.add_node_operator(Exchange10(rc208))
+    max_granular = ls.num_active_neighbours()
+
+    params = GeneticAlgorithmParams(nb_iter_granular=5, min_granular=5)
+    algo = GeneticAlgorithm(rc208, pm, rng, pop, ls, srex, init, params)
+    result = algo.run(MaxIterations(50))
+
+    assert_(result.best.is_feasible())
+    assert_equal(ls.num_active_neighbours(), max_granular)
+
+
+def test_raises_when_search_cannot_adapt_granular_neighbourhood(rc208):
+    """
+    Tests that the genetic algorithm raises when the granular neighbourhood
+    should be adapted, but the search method does not support that.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    pm = PenaltyManager()
+    pop = Population(bpd)
+    init = [Solution.make_random(rc208, rng)]
+
+    def search(solution, cost_evaluator):
+        return solution
+
+    params = GeneticAlgorithmParams(nb_iter_granular=5)
+    with assert_raises(ValueError):
+        GeneticAlgorithm(rc208, pm, rng, pop, search, srex, init, params)
@@ -0,0 +1,85 @@
+from itertools import permutations, product
+
+from numpy.testing import assert_, assert_equal
+from pytest import mark
+
+from pyvrp import Client, CostEvaluator, Solution, lower_bound, solve
+from pyvrp.stop import MaxIterations
+from tests.helpers import read_solution
+
+
+def test_lower_bound_does_not_exceed_optimal_cost(ok_small):
+    """
+    Tests that the lower bound does not exceed the cost of the optimal
+    solution, which we find by enumerating all solutions of this small
+    instance.
+    """
+    cost_eval = CostEvaluator(1, 1, 0)
+    clients = range(ok_small.num_depots, ok_small.num_locations)
+    num_vehicles = ok_small.num_vehicles
+
+    best = None
+    for order in permutations(clients):
+        # Assigns each client in the given order to a route, and keeps those
+        # assignments where each route is a contiguous part of the order.
+        for assignment in product(range(num_vehicles), repeat=len(order)):
+            if list(assignment) != sorted(assignment):
+                continue
+
+            routes = [[] for _ in range(num_vehicles)]
+            for client, route in zip(order, assignment):
+                routes[route].append(client)
+
+            sol = Solution(ok_small, [route for route in routes if route])
+            if sol.is_feasible():
+                cost = cost_eval.cost(sol)
+                best = cost if best is None else min(best, cost)
+
+    bound = lower_bound(ok_small)
+    assert_(0 < bound <= best)
+
+
+def test_lower_bound_does_not_exceed_best_known_solution(rc208):
+    """
+    Tests that the lower bound on the RC208 instance does not exceed the cost
+    of the best known solution.
+    """
+    bks = Solution(rc208, read_solution("data/RC208.sol"))
+    bks_cost = CostEvaluator(1, 1, 0).cost(bks)
+
+    bound = lower_bound(rc208)
+    assert_(0 < bound <= bks_cost)
+
+
+@mark.parametrize(
+    "instance",
+    [
+        "small_cvrp",
+        "prize_collecting",
+        "ok_small_prizes",
+        "ok_small_multi_depot",
+        "ok_small_mutually_exclusive_groups",
+    ],
+)
+def test_lower_bound_does_not_exceed_solution_cost(request, instance: str):
+    """
+    Tests that the lower bound does not exceed the cost of solutions found by
+    the solver, for a variety of instance types.
+    """
+    data = request.getfixturevalue(instance)
+    res = solve(data, stop=MaxIterations(100))
+    assert_(0 <= lower_bound(data) <= res.cost())
+
+
+def test_lower_bound_without_required_clients(ok_small_prizes):
+    """
+    Tests that the lower bound is zero when no client needs to be visited, and
+    all prizes are zero.
+    """
+    clients = [
+        Client(x=client.x, y=client.y, required=False)
+        for client in ok_small_prizes.clients()
+    ]
+
+    data = ok_small_prizes.replace(clients=clients)
+    assert_equal(lower_bound(data), 0)
@@ -260,6 +260,71 @@ def test_from_data_and_solve(small_cvrp, ok_small):
     assert_(res.is_feasible())
 
 
+def test_from_data_edges_are_created_lazily(ok_small):
+    """
+    Tests that a model created from a data instance does not create edges for
+    the data's matrices until they are accessed, and that accessing them
+    results in one edge for each pair of locations.
+    """
+    data = ok_small.replace(
+        distance_matrices=[ok_small.distance_matrix(0)] * 2,
+        duration_matrices=[ok_small.duration_matrix(0)] * 2,
+    )
+
+    m = Model.from_data(data)
+    assert_equal(len(m.profiles), 2)
+
+    for profile in m.profiles:
+        assert_(profile._distances is not None)
+        assert_equal(len(profile.edges), data.num_locations**2)
+        assert_(profile._distances is None)
+
+    # Materialising the edges should not change the resulting data instance.
+    m_data = m.data()
+    assert_equal(m_data.distance_matrices(), data.distance_matrices())
+    assert_equal(m_data.duration_matrices(), data.duration_matrices())
+
+
+def test_from_data_add_profile_edge(ok_small):
+    """
+    Tests that adding an edge to a profile of a model created from a data
+    instance changes only that edge, and does not change the original data
+    instance's matrices.
+    """
+    m = Model.from_data(ok_small)
+    frm, to = m.locations[1], m.locations[2]
+    m.add_edge(frm, to, distance=1, duration=2, profile=m.profiles[0])
+
+    m_data = m.data()
+    assert_equal(m_data.distance_matrix(0)[1, 2], 1)
+    assert_equal(m_data.duration_matrix(0)[1, 2], 2)
+
+    # All other entries should be unchanged, as should the original data.
+    expected = ok_small.distance_matrix(0).copy()
+    expected[1, 2] = 1
+    assert_equal(m_data.distance_matrix(0), expected)
+    assert_(ok_small.distance_matrix(0)[1, 2] != 1)
+
+
+def test_from_data_add_client(ok_small):
+    """
+    Tests that locations added to a model created from a data instance are
+    connected to the existing locations only by the edges that are explicitly
+    added, while the edges between existing locations are unchanged.
+    """
+    m = Model.from_data(ok_small)
+    client = m.add_client(x=1, y=1)
+    m.add_edge(client, m.locations[0], distance=3, duration=4)
+
+    m_data = m.data()
+    assert_equal(m_data.num_locations, ok_small.num_locations + 1)
+
+    dist_mat = m_data.distance_matrix(0)
+    assert_equal(dist_mat[:-1, :-1], ok_small.distance_matrix(0))
+    assert_equal(dist_mat[-1, 0], 3)
+    assert_equal(dist_mat[0, -1], MAX_VALUE)
+
+
 def test_model_and_solve(ok_small):
     """
     Tests that solving a model initialised using the modelling interface
@@ -0,0 +1,95 @@
+import threading
+
+from numpy.testing import assert_, assert_equal, assert_raises
+
+from pyvrp import (
+    NumaReplicas,
+    bind_to_numa_node,
+    current_numa_node,
+    num_numa_nodes,
+    numa_node_cpus,
+    replicate_on_numa_node,
+)
+
+
+def test_numa_topology():
+    """
+    Tests that the NUMA topology is consistent: there is at least one node,
+    the calling thread runs on one of the nodes, and nodes that do not exist
+    raise.
+    """
+    assert_(num_numa_nodes() >= 1)
+    assert_(0 <= current_numa_node() < num_numa_nodes())
+
+    for node in range(num_numa_nodes()):
+        assert_(all(cpu >= 0 for cpu in numa_node_cpus(node)))
+
+    with assert_raises(IndexError):
+        numa_node_cpus(num_numa_nodes())
+
+    with assert_raises(IndexError):
+        bind_to_numa_node(num_numa_nodes())
+
+
+def test_replicate_on_numa_node(rc208):
+    """
+    Tests that a replicated data instance is a copy of the original data.
+    """
+    replica = replicate_on_numa_node(rc208, 0)
+
+    assert_(replica is not rc208)
+    assert_equal(replica.num_clients, rc208.num_clients)
+    assert_equal(replica.distance_matrix(0), rc208.distance_matrix(0))
+    assert_equal(replica.duration_matrix(0), rc208.duration_matrix(0))
+
+    with assert_raises(IndexError):
+        replicate_on_numa_node(rc208, num_numa_nodes())
+
+
+def test_replicas_one_per_node(rc208):
+    """
+    Tests that there is one replica for each NUMA node, and that the original
+    data instance is used directly on single-node machines.
+    """
+    replicas = NumaReplicas(rc208)
+    assert_equal(len(replicas), num_numa_nodes())
+
+    for node in range(len(replicas)):
+        replica = replicas[node]
+        assert_equal(replica.distance_matrix(0), rc208.distance_matrix(0))
+
+    if num_numa_nodes() == 1:
+        assert_(replicas[0] is rc208)
+
+
+def test_bind_assigns_workers_round_robin(rc208):
+    """
+    Tests that binding workers assigns them to the nodes in round-robin
+    fashion, and that bound threads use their node's replica.
+    """
+    replicas = NumaReplicas(rc208)
+    num_nodes = len(replicas)
+    found = {}
+
+    def work(worker: int):
+        data = replicas.bind(worker)
+        found[worker] = (data, replicas.local())
+
+    threads = [
+        threading.Thread(target=work, args=(worker,))
+        for worker in range(2 * num_nodes)
+    ]
+
+    for thread in threads:
+        thread.start()
+
+    for thread in threads:
+        thread.join()
+
+    for worker, (data, local) in found.items():
+        assert_(data is replicas[worker % num_nodes])
+
+        # Bound threads only run on CPUs of their node, unless the node has no
+        # CPUs the thread may run on. Then binding does nothing.
+        if numa_node_cpus(worker % num_nodes):
+            assert_(local is data)
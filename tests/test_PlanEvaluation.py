@@ -0,0 +1,152 @@
+import numpy as np
+import pytest
+from numpy.testing import assert_, assert_equal, assert_raises
+
+from pyvrp import (
+    CostEvaluator,
+    RandomNumberGenerator,
+    Solution,
+    evaluate_plans,
+)
+
+
+def _flatten(solutions: list[Solution]):
+    """
+    Returns the flat visits, route offsets, vehicle types, and plan offsets
+    that describe the given solutions.
+    """
+    visits = []
+    route_offsets = [0]
+    vehicle_types = []
+    plan_offsets = [0]
+
+    for sol in solutions:
+        for route in sol.routes():
+            visits.extend(route.visits())
+            route_offsets.append(len(visits))
+            vehicle_types.append(route.vehicle_type())
+
+        plan_offsets.append(len(vehicle_types))
+
+    return visits, route_offsets, vehicle_types, plan_offsets
+
+
+@pytest.mark.parametrize("num_threads", [1, 4])
+def test_evaluate_plans_same_as_solution(rc208, num_threads: int):
+    """
+    Tests that the batch evaluation computes the same route and plan statistics
+    as the corresponding Solution objects.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    sols = [Solution.make_random(rc208, rng) for _ in range(50)]
+    cost_eval = CostEvaluator(20, 6, 0)
+
+    res = evaluate_plans(rc208, cost_eval, *_flatten(sols), num_threads)
+    assert_equal(len(res.cost), len(sols))
+    assert_equal(len(res.route_cost), sum(sol.num_routes() for sol in sols))
+
+    routes = [route for sol in sols for route in sol.routes()]
+    assert_equal(res.route_distance, [route.distance() for route in routes])
+    assert_equal(res.route_duration, [route.duration() for route in routes])
+    assert_equal(res.route_time_warp, [route.time_warp() for route in routes])
+    assert_equal(
+        res.route_excess_load,
+        [route.excess_load() for route in routes],
+    )
+
+    assert_equal(res.distance, [sol.distance() for sol in sols])
+    assert_equal(res.duration, [sol.duration() for sol in sols])
+    assert_equal(res.time_warp, [sol.time_warp() for sol in sols])
+    assert_equal(res.excess_load, [sol.excess_load() for sol in sols])
+    assert_equal(res.feasible, [sol.is_feasible() for sol in sols])
+    assert_equal(res.cost, [cost_eval.cost(sol) for sol in sols])
+    assert_equal(
+        res.penalised_cost,
+        [cost_eval.penalised_cost(sol) for sol in sols],
+    )
+
+
+def test_evaluate_plans_feasibility(ok_small):
+    """
+    Tests that plans that are missing clients, visit clients more than once, or
+    use too many vehicles are marked infeasible rather than rejected.
+    """
+    cost_eval = CostEvaluator(1, 1, 0)
+    visits = [1, 2, 3, 4, 1, 2, 3, 1, 2, 3, 4, 4, 1, 2, 3, 4]
+    route_offsets = [0, 2, 4, 7, 9, 11, 12, 13, 14, 15, 16]
+    vehicle_types = [0] * 10
+    plan_offsets = [0, 2, 3, 6, 10]
+
+    res = evaluate_plans(
+        ok_small,
+        cost_eval,
+        visits,
+        route_offsets,
+        vehicle_types,
+        plan_offsets,
+    )
+
+    sol = Solution(ok_small, [[1, 2], [3, 4]])
+    assert_equal(res.feasible[0], sol.is_feasible())
+    assert_equal(res.penalised_cost[0], cost_eval.penalised_cost(sol))
+
+    assert_(not res.feasible[1])  # client 4 is missing
+    assert_(not res.feasible[2])  # client 4 is visited twice
+    assert_equal(res.cost[2], np.iinfo(np.int64).max)
+
+    # The last plan visits each client on its own route, which uses four
+    # vehicles while only three are available. Each route is feasible.
+    assert_(not res.feasible[3])
+    assert_(np.all(res.route_feasible[6:]))
+
+
+def test_evaluate_plans_empty_routes_and_plans(ok_small):
+    """
+    Tests that empty routes do not incur costs, and that an empty plan has no
+    costs other than its uncollected prizes.
+    """
+    cost_eval = CostEvaluator(1, 1, 0)
+    visits = [1]
+    route_offsets = [0, 0, 1]  # the first route is empty
+    plan_offsets = [0, 0, 2]  # the first plan has no routes
+    res = evaluate_plans(
+        ok_small, cost_eval, visits, route_offsets, [0, 0], plan_offsets
+    )
+
+    assert_equal(res.route_cost[0], 0)
+    assert_(res.route_feasible[0])
+    assert_equal(res.distance[0], 0)
+    assert_(not res.feasible[0])  # empty plan does not visit any clients
+
+    sol = Solution(ok_small, [[1]])
+    assert_equal(res.distance[1], sol.distance())
+    assert_equal(res.penalised_cost[1], cost_eval.penalised_cost(sol))
+
+
+def test_evaluate_plans_raises_invalid_arguments(ok_small):
+    """
+    Tests that evaluate_plans raises when the offsets are inconsistent, or the
+    visits or vehicle types do not exist.
+    """
+    cost_eval = CostEvaluator(1, 1, 0)
+
+    with assert_raises(ValueError):  # route offsets must end at len(visits)
+        evaluate_plans(ok_small, cost_eval, [1, 2], [0, 1], [0], [0, 1])
+
+    with assert_raises(ValueError):  # offsets must be non-decreasing
+        evaluate_plans(ok_small, cost_eval, [1], [0, 2, 1], [0, 0], [0, 2])
+
+    with assert_raises(ValueError):  # a vehicle type for each route
+        evaluate_plans(ok_small, cost_eval, [1], [0, 1], [0, 0], [0, 2])
+
+    with assert_raises(ValueError):  # plan offsets must end at num routes
+        evaluate_plans(ok_small, cost_eval, [1], [0, 1], [0], [0, 2])
+
+    with assert_raises(ValueError):  # at least one thread
+        evaluate_plans(ok_small, cost_eval, [1], [0, 1], [0], [0, 1], 0)
+
+    with assert_raises(IndexError):  # 0 is a depot, not a client
+        evaluate_plans(ok_small, cost_eval, [0], [0, 1], [0], [0, 1])
+
+    with assert_raises(IndexError):  # vehicle type 1 does not exist
+        evaluate_plans(ok_small, cost_eval, [1], [0, 1], [1], [0, 1])
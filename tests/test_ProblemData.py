@@ -380,6 +380,34 @@ def test_matrix_access():
     assert_equal(data.duration_matrix(profile=0), dur_mat)
 
 
+@pytest.mark.parametrize("no_huge_pages", ["0", "1"])
+def test_large_matrix_access(monkeypatch, no_huge_pages: str):
+    """
+    Tests that large matrices, which may be backed by huge pages, correctly
+    store the data, also when huge pages are disabled.
+    """
+    monkeypatch.setenv("PYVRP_NO_HUGE_PAGES", no_huge_pages)
+
+    gen = default_rng(seed=42)
+    size = 1_000  # 8MB per matrix, which is more than one 2MB huge page
+
+    dist_mat = gen.integers(500, size=(size, size))
+    np.fill_diagonal(dist_mat, 0)
+
+    depot = Depot(x=0, y=0)
+    clients = [Client(x=0, y=0) for _ in range(size - 1)]
+    data = ProblemData(
+        clients=clients,
+        depots=[depot],
+        vehicle_types=[VehicleType(2, capacity=1)],
+        distance_matrices=[dist_mat],
+        duration_matrices=[dist_mat],
+    )
+
+    assert_equal(data.distance_matrix(profile=0), dist_mat)
+    assert_equal(data.duration_matrix(profile=0), dist_mat)
+
+
 def test_matrices_are_not_writeable():
     """
     Tests that the data matrices provided by ``distance_matrix()`` and
@@ -798,3 +826,60 @@ def test_replacing_client_groups(ok_small):
     # client as its only member.
     assert_equal(data.num_groups, 1)
     assert_equal(data.group(0).clients, [1])
+
+
+def test_location_columns(ok_small_mutually_exclusive_groups):
+    """
+    Tests that the column accessors return the same data as the individual
+    client and depot objects, indexed by location.
+    """
+    data = ok_small_mutually_exclusive_groups
+    depots = data.depots()
+    clients = data.clients()
+    locs = depots + clients
+
+    assert_equal(data.x(), [loc.x for loc in locs])
+    assert_equal(data.y(), [loc.y for loc in locs])
+    assert_equal(data.tw_early(), [loc.tw_early for loc in locs])
+    assert_equal(data.tw_late(), [loc.tw_late for loc in locs])
+
+    # Depots do not have these attributes, and are padded with neutral values.
+    padding = [0] * len(depots)
+    assert_equal(data.delivery(), padding + [c.delivery for c in clients])
+    assert_equal(data.pickup(), padding + [c.pickup for c in clients])
+    assert_equal(
+        data.service_duration(),
+        padding + [c.service_duration for c in clients],
+    )
+    assert_equal(
+        data.release_time(),
+        padding + [c.release_time for c in clients],
+    )
+    assert_equal(data.prize(), padding + [c.prize for c in clients])
+    assert_equal(
+        data.required(),
+        [False] * len(depots) + [c.required for c in clients],
+    )
+
+    groups = [-1 if c.group is None else c.group for c in clients]
+    assert_equal(data.group_membership(), [-1] * len(depots) + groups)
+
+
+def test_location_columns_are_read_only_views(ok_small):
+    """
+    Tests that the column accessors return views into data owned by the
+    ProblemData instance, and that those views cannot be modified.
+    """
+    x1 = ok_small.x()
+    x2 = ok_small.x()
+    assert_(not x1.flags["OWNDATA"])
+    assert_(x1.base is x2.base)
+
+    assert_equal(ok_small.required().dtype, np.bool_)
+    assert_equal(ok_small.group_membership().dtype, np.int64)
+
+    with assert_raises(ValueError):
+        x1[0] = 1_000
+
+    with assert_raises(ValueError):
+        ok_small.required()[0] = True
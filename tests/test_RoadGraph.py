@@ -0,0 +1,232 @@
+from concurrent.futures import ThreadPoolExecutor
+
+import numpy as np
+import pytest
+from numpy.testing import assert_, assert_equal, assert_raises
+
+from pyvrp import RoadGraph
+from pyvrp.constants import MAX_VALUE
+
+_GRAPH = """
+# A small road graph with five nodes. The direct arc from 0 to 2 is shorter in
+# distance than the path through 1, but takes longer. Node 4 can only be left.
+p 5 8
+v 0 0 0
+v 1 1 0
+v 2 2 0
+v 3 2 2
+v 4 0 3
+a 0 1 10 1
+a 1 0 10 1
+a 1 2 10 1
+a 2 1 10 1
+a 0 2 5 3
+a 2 3 4 2
+a 3 0 7 1
+a 4 0 1 1
+"""
+
+# Shortest path distances and durations between nodes 0, 2, and 3. Paths
+# minimise duration first, and distance second.
+_DISTANCES = [[0, 20, 24], [20, 0, 4], [7, 27, 0]]
+_DURATIONS = [[0, 2, 4], [2, 0, 2], [1, 3, 0]]
+
+
+@pytest.fixture
+def graph_file(tmp_path):
+    path = tmp_path / "graph.txt"
+    path.write_text(_GRAPH)
+    return str(path)
+
+
+def test_row(graph_file):
+    """
+    Tests that the rows agree with the shortest paths in the graph.
+    """
+    graph = RoadGraph(graph_file)
+    assert_equal(graph.num_nodes(), 5)
+
+    graph.set_locations([0, 2, 3])
+    assert_equal(graph.num_locations(), 3)
+
+    for location in range(3):
+        distances, durations = graph.row(location)
+        assert_equal(distances, _DISTANCES[location])
+        assert_equal(durations, _DURATIONS[location])
+
+
+def test_matrices(graph_file):
+    """
+    Tests that the full matrices agree with the rows, also when computed with
+    multiple threads.
+    """
+    graph = RoadGraph(graph_file)
+    graph.set_locations([0, 2, 3])
+
+    for num_threads in [1, 2, 4]:
+        distances, durations = graph.matrices(num_threads=num_threads)
+        assert_equal(distances, _DISTANCES)
+        assert_equal(durations, _DURATIONS)
+
+
+def test_matrices_in_problem_data(ok_small, graph_file):
+    """
+    Tests that the matrices can be used in a data instance, and that locations
+    that cannot be reached get distance and duration MAX_VALUE.
+    """
+    graph = RoadGraph(graph_file)
+    graph.set_locations([0, 1, 2, 3, 4])
+    distances, durations = graph.matrices()
+
+    # Node 4 cannot be reached from any other node, but can reach all others.
+    assert_equal(distances[:4, 4], MAX_VALUE)
+    assert_equal(durations[:4, 4], MAX_VALUE)
+    assert_(np.all(distances[4, :] < MAX_VALUE))
+
+    data = ok_small.replace(
+        distance_matrices=[distances],
+        duration_matrices=[durations],
+    )
+
+    assert_equal(data.distance_matrix(0), distances)
+    assert_equal(data.duration_matrix(0), durations)
+
+
+def test_row_cache_is_bounded(graph_file):
+    """
+    Tests that the row cache never contains more than the given number of rows,
+    and that evicted rows are recomputed correctly.
+    """
+    graph = RoadGraph(graph_file, max_cached_rows=2)
+    graph.set_locations([0, 2, 3])
+    assert_equal(graph.num_cached_rows(), 0)
+
+    for location in [0, 1, 2, 0]:
+        distances, _ = graph.row(location)
+        assert_equal(distances, _DISTANCES[location])
+        assert_(graph.num_cached_rows() <= 2)
+
+    assert_equal(graph.num_cached_rows(), 2)
+
+    graph.set_locations([0, 2])  # changing the locations clears the cache
+    assert_equal(graph.num_cached_rows(), 0)
+
+
+def test_add_location_extends_cached_rows(graph_file):
+    """
+    Tests that adding a location extends the rows in the cache with the
+    distance and duration to the new location.
+    """
+    graph = RoadGraph(graph_file)
+    graph.set_locations([0, 2])
+
+    distances, _ = graph.row(0)  # this row is now in the cache
+    assert_equal(distances, _DISTANCES[0][:2])
+
+    assert_equal(graph.add_location(3), 2)
+    assert_equal(graph.num_locations(), 3)
+
+    for location in range(3):
+        distances, durations = graph.row(location)
+        assert_equal(distances, _DISTANCES[location])
+        assert_equal(durations, _DURATIONS[location])
+
+
+def test_nearest_node(graph_file):
+    """
+    Tests that the nearest node is found using the node coordinates.
+    """
+    graph = RoadGraph(graph_file)
+    assert_equal(graph.nearest_node(0, 0), 0)
+    assert_equal(graph.nearest_node(3, 0), 2)
+    assert_equal(graph.nearest_node(3, 3), 3)
+    assert_equal(graph.nearest_node(-1, 4), 4)
+
+
+def test_nearest_node_raises_without_coordinates(tmp_path):
+    """
+    Tests that the nearest node cannot be found when the graph file does not
+    provide coordinates for all nodes.
+    """
+    path = tmp_path / "graph.txt"
+    path.write_text("p 2 1\nv 0 0 0\na 0 1 1 1\n")
+
+    graph = RoadGraph(str(path))
+    with assert_raises(ValueError):
+        graph.nearest_node(0, 0)
+
+
+@pytest.mark.parametrize(
+    "contents",
+    [
+        "",  # empty file
+        "a 0 1 1 1\n",  # arc before header
+        "p 2 2\na 0 1 1 1\n",  # fewer arcs than in the header
+        "p 2 1\na 0 2 1 1\n",  # node 2 does not exist
+        "p 2 1\na 0 1 -1 1\n",  # negative distance
+        "p 2 1\nx 0 1\n",  # unknown line type
+    ],
+)
+def test_raises_for_invalid_graph_file(tmp_path, contents: str):
+    """
+    Tests that malformed graph files are rejected.
+    """
+    path = tmp_path / "graph.txt"
+    path.write_text(contents)
+
+    with assert_raises(ValueError):
+        RoadGraph(str(path))
+
+
+def test_raises_for_invalid_arguments(tmp_path, graph_file):
+    """
+    Tests that the road graph raises for missing files, an empty row cache,
+    and nodes or locations that do not exist.
+    """
+    with assert_raises(ValueError):
+        RoadGraph(str(tmp_path / "does_not_exist.txt"))
+
+    with assert_raises(ValueError):
+        RoadGraph(graph_file, max_cached_rows=0)
+
+    graph = RoadGraph(graph_file)
+    with assert_raises(IndexError):
+        graph.set_locations([0, 5])
+
+    with assert_raises(IndexError):
+        graph.add_location(5)
+
+    graph.set_locations([0, 1])
+    with assert_raises(IndexError):
+        graph.row(2)
+
+    with assert_raises(ValueError):
+        graph.matrices(num_threads=0)
+
+
+def test_concurrent_use(graph_file):
+    """
+    Tests that the road graph can be used from multiple threads at the same
+    time, while locations are added and rows are evicted from the cache.
+    """
+    graph = RoadGraph(graph_file, max_cached_rows=2)
+    graph.set_locations([0, 2, 3])
+
+    def work(idx: int):
+        if idx % 10 == 0:
+            graph.add_location(4)
+
+        location = idx % 3
+        distances, durations = graph.row(location)
+        assert_equal(distances[:3], _DISTANCES[location])
+        assert_equal(durations[:3], _DURATIONS[location])
+
+        dist_mat, dur_mat = graph.matrices(num_threads=2)
+        assert_equal(dist_mat[:3, :3], _DISTANCES)
+        assert_equal(dur_mat[:3, :3], _DURATIONS)
+
+    with ThreadPoolExecutor(max_workers=8) as executor:
+        list(executor.map(work, range(100)))
+
+    assert_equal(graph.num_locations(), 13)
+    assert_(graph.num_cached_rows() <= 2)
@@ -0,0 +1,222 @@
+import numpy as np
+import pytest
+from numpy.testing import assert_, assert_equal, assert_raises
+
+from pyvrp import Client, VehicleType
+from pyvrp.constants import MAX_VALUE
+from pyvrp.RollingHorizon import RollingHorizon, RollingHorizonParams
+
+
+def _make_driver(data, **kwargs) -> RollingHorizon:
+    """
+    Returns a rolling horizon driver for the depots and vehicle types of the
+    given instance, whose location indices are those of the given instance.
+    """
+
+    def matrices(ids: np.ndarray):
+        idcs = np.ix_(ids, ids)
+        return data.distance_matrix(0)[idcs], data.duration_matrix(0)[idcs]
+
+    params = RollingHorizonParams(time_limit=0.05)
+    return RollingHorizon(
+        data.depots(), data.vehicle_types(), matrices, params, **kwargs
+    )
+
+
+def test_params_raises_negative_time_limit():
+    """
+    Tests that a negative time limit is rejected.
+    """
+    with assert_raises(ValueError):
+        RollingHorizonParams(time_limit=-1)
+
+
+def test_raises_for_multiple_profiles(ok_small):
+    """
+    Tests that the driver only supports vehicle types of the first profile.
+    """
+    with assert_raises(ValueError):
+        RollingHorizon(
+            ok_small.depots(),
+            [VehicleType(profile=1)],
+            lambda ids: (None, None),
+        )
+
+
+def test_add_clients_raises_invalid_arguments(ok_small):
+    """
+    Tests that add_clients raises when the indices are invalid, or the clients
+    are part of a client group.
+    """
+    driver = _make_driver(ok_small)
+    client = ok_small.location(1)
+
+    with assert_raises(ValueError):  # number of ids and clients differ
+        driver.add_clients([1, 2], [client])
+
+    with assert_raises(ValueError):  # index of the depot
+        driver.add_clients([0], [client])
+
+    with assert_raises(ValueError):  # repeated index
+        driver.add_clients([1, 1], [client, client])
+
+    with assert_raises(ValueError):  # client groups are not supported
+        driver.add_clients([1], [Client(x=0, y=0, required=False, group=0)])
+
+    driver.add_clients([1], [client])
+    with assert_raises(ValueError):  # client 1 is already outstanding
+        driver.add_clients([1], [client])
+
+
+def test_replan_plans_all_clients(ok_small):
+    """
+    Tests that the plan visits all clients that have been added, including
+    those that arrive after the first plan was made.
+    """
+    driver = _make_driver(ok_small)
+    assert_(driver.plan is None)
+
+    driver.add_clients([1, 2], [ok_small.location(1), ok_small.location(2)])
+    plan = driver.replan(now=0)
+    assert_equal(plan.num_clients(), 2)
+    assert_equal(driver.data.num_clients, 2)
+
+    driver.add_clients([3, 4], [ok_small.location(3), ok_small.location(4)])
+    plan = driver.replan(now=0)
+
+    # Stops of the first plan that were dispatched at time 0 are no longer
+    # part of the new plan.
+    dispatched = sum(len(stops) for stops in driver.dispatched())
+    assert_equal(plan.num_clients() + dispatched, 4)
+
+
+@pytest.mark.parametrize("seed", [1, 2])
+def test_replan_dispatches_each_client_once(ok_small, seed: int):
+    """
+    Tests that over the course of the day, every client is dispatched exactly
+    once, and that dispatched clients are removed from the re-optimised
+    instance.
+    """
+    driver = _make_driver(ok_small, seed=seed)
+    clients = [ok_small.location(idx) for idx in range(1, 5)]
+
+    driver.add_clients([1, 2], clients[:2])
+    driver.replan(now=0)
+
+    for now in range(0, 50_000, 2_500):
+        if now == 5_000:
+            driver.add_clients([3, 4], clients[2:])
+
+        plan = driver.replan(now)
+        dispatched = [idx for stops in driver.dispatched() for idx in stops]
+        assert_equal(len(dispatched), len(set(dispatched)))
+        assert_equal(driver.data.num_clients + len(dispatched), 4)
+        assert_(plan.num_clients() <= driver.data.num_clients)
+
+    # At the end of the day, everything has been dispatched.
+    dispatched = [idx for stops in driver.dispatched() for idx in stops]
+    assert_equal(sorted(dispatched), [1, 2, 3, 4])
+    assert_equal(driver.data.num_clients, 0)
+
+
+def test_dispatched_vehicle_starts_from_last_stop(ok_small):
+    """
+    Tests that a vehicle that has been dispatched continues from its last
+    dispatched stop, with the capacity that remains.
+    """
+    driver = _make_driver(ok_small)
+    clients = [ok_small.location(idx) for idx in range(1, 5)]
+    driver.add_clients([1, 2, 3, 4], clients)
+
+    plan = driver.replan(now=0)
+    route = plan.routes()[0]
+    first = route.visits()[0]
+
+    # After the vehicle leaves the depot, its first stop is dispatched. The
+    # vehicle then continues from that stop, with the capacity that is not
+    # taken up by the amount picked up there.
+    driver.replan(now=route.start_time())
+    dispatched = [stops for stops in driver.dispatched() if stops]
+    assert_(any(stops[0] == first for stops in dispatched))
+
+    data = driver.data
+    capacity = ok_small.vehicle_type(0).capacity
+    pickup = clients[first - 1].pickup
+    capacities = [veh_type.capacity for veh_type in data.vehicle_types()]
+    assert_(capacity - pickup in capacities)
+
+
+def test_dispatched_vehicle_capacity_counts_pickups_only(ok_small):
+    """
+    Tests that a dispatched vehicle's remaining capacity only accounts for the
+    amounts picked up at its dispatched stops.
+    """
+    veh_type = VehicleType(capacity=10)
+    driver = _make_driver(ok_small.replace(vehicle_types=[veh_type]))
+
+    # A single client with both a delivery and a pickup amount. Once the
+    # vehicle has left for this client, the client is dispatched.
+    client = Client(x=1, y=1, delivery=6, pickup=3)
+    driver.add_clients([1], [client])
+    plan = driver.replan(now=0)
+    driver.replan(now=plan.routes()[0].start_time())
+    assert_equal(driver.dispatched(), [[1]])
+
+    # The delivered amount no longer takes up space, but the pickup amount
+    # does. The dispatched vehicle thus has capacity 10 - 3 = 7 left, not
+    # 10 - 6 - 3 = 1.
+    data = driver.data
+    assert_equal(data.num_vehicle_types, 1)
+    assert_equal(data.vehicle_type(0).capacity, 7)
+
+
+def test_dispatched_vehicle_only_delivers_goods_on_board(ok_small):
+    """
+    Tests that a dispatched vehicle cannot serve delivery clients whose goods
+    it did not load at the depot, and that vehicles that have not yet been
+    dispatched cannot serve clients whose goods are on another vehicle.
+    """
+    veh_type = VehicleType(num_available=2, capacity=10, fixed_cost=100_000)
+    driver = _make_driver(ok_small.replace(vehicle_types=[veh_type]))
+
+    # The large fixed cost ensures both clients are planned on the same route,
+    # so the vehicle loads the goods of both when it leaves the depot. After
+    # the first stop has been dispatched, the goods for the second client
+    # remain on board.
+    clients = [Client(x=1, y=1, delivery=2), Client(x=2, y=2, delivery=2)]
+    driver.add_clients([1, 2], clients)
+    plan = driver.replan(now=0)
+    assert_equal(plan.num_routes(), 1)
+
+    route = plan.routes()[0]
+    first, second = route.visits()
+    driver.replan(now=route.start_time())
+    assert_equal(driver.dispatched(), [[first], []])
+
+    # Now a delivery client and a pickup client arrive. The idle vehicle has
+    # the first profile, and the dispatched vehicle the second.
+    new_clients = [Client(x=3, y=3, delivery=2), Client(x=4, y=4, pickup=2)]
+    driver.add_clients([3, 4], new_clients)
+    plan = driver.replan(now=route.start_time())
+    data = driver.data
+    assert_equal(data.num_profiles, 2)
+    assert_equal(data.vehicle_type(0).profile, 0)
+    assert_equal(data.vehicle_type(1).profile, 1)
+
+    # The idle vehicle cannot reach the client whose goods are on board of
+    # the dispatched vehicle, and the dispatched vehicle cannot reach the
+    # newly arrived delivery client. Both can reach the pickup client.
+    idle_dist = data.distance_matrix(0)
+    dispatched_dist = data.distance_matrix(1)
+    on_board_coords = (clients[second - 1].x, clients[second - 1].y)
+
+    for idx in range(data.num_depots, data.num_locations):
+        client = data.location(idx)
+        on_board = (client.x, client.y) == on_board_coords
+        new_delivery = client.delivery > 0 and not on_board
+
+        assert_equal(idle_dist[0, idx] == MAX_VALUE, on_board)
+        assert_equal(dispatched_dist[1, idx] == MAX_VALUE, new_delivery)
+
+    assert_equal(plan.num_clients(), 3)
+    assert_(plan.is_feasible())
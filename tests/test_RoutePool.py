@@ -0,0 +1,115 @@
+from numpy.testing import assert_, assert_equal, assert_raises
+
+from pyvrp import CostEvaluator, RandomNumberGenerator, RoutePool, Solution
+from tests.helpers import read_solution
+
+
+def test_raises_when_max_size_is_zero(ok_small):
+    """
+    Tests that the route pool cannot be created without room for any routes.
+    """
+    with assert_raises(ValueError):
+        RoutePool(ok_small, max_size=0)
+
+
+def test_add_deduplicates_routes(rc208):
+    """
+    Tests that the route pool only stores distinct, feasible routes.
+    """
+    bks = Solution(rc208, read_solution("data/RC208.sol"))
+    pool = RoutePool(rc208)
+    assert_equal(len(pool), 0)
+
+    # All routes in the best known solution are feasible and distinct, so they
+    # should all be added to the pool.
+    pool.add(bks)
+    assert_equal(len(pool), bks.num_routes())
+
+    # Adding the same solution again should not add any more routes.
+    pool.add(bks)
+    assert_equal(len(pool), bks.num_routes())
+
+    pool.clear()
+    assert_equal(len(pool), 0)
+
+
+def test_add_skips_infeasible_routes(rc208):
+    """
+    Tests that infeasible routes are not added to the route pool.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    sol = Solution.make_random(rc208, rng)
+
+    pool = RoutePool(rc208)
+    pool.add(sol)
+
+    num_feasible = sum(route.is_feasible() for route in sol.routes())
+    assert_(num_feasible < sol.num_routes())
+    assert_equal(len(pool), num_feasible)
+
+
+def test_pool_does_not_exceed_max_size(rc208):
+    """
+    Tests that the route pool removes routes when it is full.
+    """
+    bks = Solution(rc208, read_solution("data/RC208.sol"))
+    pool = RoutePool(rc208, max_size=2)
+
+    pool.add(bks)
+    assert_(bks.num_routes() > 2)
+    assert_equal(len(pool), 2)
+
+
+def test_select_improves_on_incumbent(rc208):
+    """
+    Tests that selecting routes from the pool returns a new solution only when
+    that solution improves on the incumbent.
+    """
+    bks = Solution(rc208, read_solution("data/RC208.sol"))
+    pool = RoutePool(rc208)
+    pool.add(bks)
+
+    # The pool only contains the routes of the best known solution, so it
+    # cannot improve on that solution.
+    assert_(pool.select(bks) is None)
+
+    # But it does improve on an infeasible solution, by selecting all routes of
+    # the best known solution.
+    rng = RandomNumberGenerator(seed=42)
+    sol = Solution.make_random(rc208, rng)
+    assert_(not sol.is_feasible())
+
+    cost_evaluator = CostEvaluator(20, 6, 0)
+    selected = pool.select(sol)
+    assert_(selected is not None)
+    assert_(selected.is_feasible())
+    assert_equal(cost_evaluator.cost(selected), cost_evaluator.cost(bks))
+
+
+def test_select_recombines_routes(rc208):
+    """
+    Tests that selecting routes from the pool combines routes from different
+    solutions into a new solution.
+    """
+    bks = Solution(rc208, read_solution("data/RC208.sol"))
+    routes = [route.visits() for route in bks.routes()]
+    half = len(routes) // 2
+
+    # Each of these solutions has half of the best known solution's routes,
+    # and puts all other clients in a single route.
+    first = routes[:half] + [[c for r in routes[half:] for c in r]]
+    second = [[c for r in routes[:half] for c in r]] + routes[half:]
+
+    pool = RoutePool(rc208)
+    pool.add(Solution(rc208, first))
+    pool.add(Solution(rc208, second))
+
+    # The pool now contains all routes of the best known solution, which the
+    # selection should combine into a solution that is at least as good.
+    cost_evaluator = CostEvaluator(20, 6, 0)
+    sol = Solution.make_random(rc208, RandomNumberGenerator(seed=42))
+    selected = pool.select(sol)
+
+    assert_(selected is not None)
+    assert_(selected.is_feasible())
+    assert_(cost_evaluator.cost(selected) <= cost_evaluator.cost(bks))
@@ -160,3 +160,26 @@ def test_fitness_is_average_of_cost_and_diversity_when_no_elites(rc208):
     # agree with what we've computed above.
     assert_(((actual_fitness >= 0) & (actual_fitness <= 1)).all())
     assert_allclose(actual_fitness, expected_fitness)
+
+
+def test_add_shares_solution(ok_small):
+    """
+    Tests that the subpopulation stores the added solution itself, rather than
+    a copy, and that the solution remains valid after the caller's reference
+    goes away.
+    """
+    cost_evaluator = CostEvaluator(20, 6, 0)
+    rng = RandomNumberGenerator(seed=42)
+
+    subpop = SubPopulation(bpd, PopulationParams())
+    sol = Solution.make_random(ok_small, rng)
+    subpop.add(sol, cost_evaluator)
+    assert_(subpop[0].solution is sol)
+
+    # Deleting our reference should not invalidate the solution that is now
+    # also owned by the subpopulation.
+    routes = [route.visits() for route in sol.routes()]
+    del sol
+
+    stored = subpop[0].solution
+    assert_equal([route.visits() for route in stored.routes()], routes)
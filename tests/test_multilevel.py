@@ -0,0 +1,108 @@
+import pytest
+from numpy.testing import assert_, assert_equal, assert_raises
+
+from pyvrp import RandomNumberGenerator, Solution
+from pyvrp.multilevel import (
+    MultilevelParams,
+    coarsen,
+    solve_multilevel,
+    uncoarsen,
+)
+from pyvrp.stop import MaxIterations
+
+
+@pytest.mark.parametrize(
+    ("num_clients", "max_levels", "min_reduction"),
+    [
+        (-1, 10, 0.05),  # num_clients cannot be negative
+        (1_000, -1, 0.05),  # max_levels cannot be negative
+        (1_000, 10, -0.1),  # min_reduction must be in [0, 1]
+        (1_000, 10, 1.1),  # min_reduction must be in [0, 1]
+    ],
+)
+def test_params_raises_invalid_arguments(
+    num_clients: int,
+    max_levels: int,
+    min_reduction: float,
+):
+    """
+    Tests that invalid multilevel parameters are rejected.
+    """
+    with assert_raises(ValueError):
+        MultilevelParams(num_clients, max_levels, min_reduction)
+
+
+def test_coarsen_partitions_clients(rc208):
+    """
+    Tests that the clusters returned by coarsen partition the original clients,
+    and that each cluster contains at most two clients.
+    """
+    coarse, clusters = coarsen(rc208)
+    assert_equal(coarse.num_depots, rc208.num_depots)
+    assert_equal(coarse.num_clients, len(clusters))
+    assert_(coarse.num_clients < rc208.num_clients)
+
+    clients = sorted(client for cluster in clusters for client in cluster)
+    assert_equal(clients, list(range(rc208.num_depots, rc208.num_locations)))
+    assert_(all(1 <= len(cluster) <= 2 for cluster in clusters))
+
+
+@pytest.mark.parametrize("seed", [1, 2, 3])
+def test_uncoarsen_preserves_distance_and_load(rc208, seed: int):
+    """
+    Tests that uncoarsening a solution to the coarse instance results in a
+    solution to the original instance with the same distance and load, and
+    the same duration when the solution has no time warp.
+    """
+    data = rc208
+    for _ in range(2):  # checks two levels of coarsening
+        coarse, clusters = coarsen(data)
+
+        rng = RandomNumberGenerator(seed=seed)
+        coarse_sol = Solution.make_random(coarse, rng)
+        sol = uncoarsen(coarse_sol, data, clusters)
+
+        assert_(sol.is_complete())
+        assert_equal(sol.num_routes(), coarse_sol.num_routes())
+        assert_equal(sol.distance(), coarse_sol.distance())
+        assert_equal(sol.excess_load(), coarse_sol.excess_load())
+
+        if not coarse_sol.has_time_warp():
+            assert_(not sol.has_time_warp())
+            assert_equal(sol.duration(), coarse_sol.duration())
+
+        data = coarse
+
+
+def test_coarsen_does_not_merge_optional_clients(ok_small_prizes):
+    """
+    Tests that optional clients are never merged.
+    """
+    coarse, clusters = coarsen(ok_small_prizes)
+
+    for cluster in clusters:
+        if len(cluster) > 1:
+            clients = [ok_small_prizes.location(idx) for idx in cluster]
+            assert_(all(client.required for client in clients))
+
+
+def test_solve_multilevel(rc208):
+    """
+    Smoke test that checks solve_multilevel returns a complete solution to the
+    original instance, also when it is coarsened over multiple levels.
+    """
+    params = MultilevelParams(num_clients=25)
+    res = solve_multilevel(rc208, MaxIterations(10), multilevel_params=params)
+
+    assert_(res.best.is_complete())
+    assert_equal(res.best.num_clients(), rc208.num_clients)
+
+
+def test_solve_multilevel_without_coarsening(ok_small):
+    """
+    Tests that solve_multilevel does not coarsen instances that already have
+    few enough clients, and then just solves the instance directly.
+    """
+    res = solve_multilevel(ok_small, MaxIterations(10))
+    assert_(res.best.is_complete())
+    assert_equal(res.best.num_clients(), ok_small.num_clients)
@@ -28,6 +28,8 @@ def test_default_values():
     assert_equal(params.neighbourhood, NeighbourhoodParams())
     assert_equal(params.node_ops, NODE_OPERATORS)
     assert_equal(params.route_ops, ROUTE_OPERATORS)
+    assert_equal(params.adaptive_operators, False)
+    assert_equal(params.neighbourhood_cache, None)
 
 
 def test_solve_params_from_file():
@@ -49,6 +51,7 @@ def test_solve_params_from_file():
     assert_equal(params.neighbourhood, neighbourhood)
     assert_equal(params.node_ops, node_ops)
     assert_equal(params.route_ops, route_ops)
+    assert_equal(params.adaptive_operators, True)
 
 
 def test_solve_params_from_file_defaults():
@@ -60,6 +63,28 @@ def test_solve_params_from_file_defaults():
     assert_equal(params, SolveParams())
 
 
+def test_solve_params_replace():
+    """
+    Tests that replace() only changes the explicitly passed parameters, and
+    leaves the original parameters object unchanged.
+    """
+    params = SolveParams.from_file(DATA_DIR / "test_config.toml")
+    assert_equal(params.replace(), params)
+
+    replaced = params.replace(neighbourhood_cache="cache", route_ops=[])
+    assert_equal(replaced.neighbourhood_cache, "cache")
+    assert_equal(replaced.route_ops, [])
+    assert_equal(params.neighbourhood_cache, None)
+    assert_equal(params.route_ops, [SwapStar])
+
+    assert_equal(replaced.genetic, params.genetic)
+    assert_equal(replaced.penalty, params.penalty)
+    assert_equal(replaced.population, params.population)
+    assert_equal(replaced.neighbourhood, params.neighbourhood)
+    assert_equal(replaced.node_ops, params.node_ops)
+    assert_equal(replaced.adaptive_operators, params.adaptive_operators)
+
+
 def test_solve_same_seed(ok_small):
     """
     Smoke test that checks that that solving an instance with the same seed
@@ -0,0 +1,153 @@
+from concurrent.futures import ThreadPoolExecutor
+
+from numpy.testing import assert_, assert_equal
+
+from pyvrp import (
+    CostEvaluator,
+    Population,
+    RandomNumberGenerator,
+    Solution,
+    solve,
+)
+from pyvrp.diversity import broken_pairs_distance as bpd
+from pyvrp.search import (
+    Exchange10,
+    Exchange11,
+    LocalSearch,
+    SwapStar,
+    compute_neighbours,
+)
+from pyvrp.stop import MaxIterations
+
+# These tests share objects between threads. The extension modules declare that
+# they do not need the GIL, so on free-threaded Python builds (such as 3.13t)
+# the threads can run in parallel. On other builds, the GIL is released while
+# the local search runs, so that the searches still overlap.
+NUM_THREADS = 8
+
+
+def test_concurrent_solves_match_sequential_solves(ok_small):
+    """
+    Tests that solving the same problem data in several threads at the same
+    time gives exactly the same results as solving sequentially.
+    """
+
+    def run(seed: int):
+        res = solve(ok_small, MaxIterations(200), seed, collect_stats=False)
+        return res.best, res.cost()
+
+    seeds = list(range(NUM_THREADS))
+    sequential = [run(seed) for seed in seeds]
+
+    with ThreadPoolExecutor(max_workers=NUM_THREADS) as executor:
+        concurrent = list(executor.map(run, seeds))
+
+    assert_equal(concurrent, sequential)
+
+
+def test_concurrent_solution_evaluation(rc208):
+    """
+    Tests that solutions can be created from, and evaluated against, shared
+    problem data and cost evaluators from multiple threads.
+    """
+    cost_eval = CostEvaluator(20, 6, 0)
+
+    def run(seed: int):
+        rng = RandomNumberGenerator(seed=seed)
+        costs = []
+
+        for _ in range(100):
+            sol = Solution.make_random(rc208, rng)
+            copy = Solution(rc208, sol.routes())
+            assert_equal(copy, sol)
+            costs.append(cost_eval.penalised_cost(sol))
+
+        return costs
+
+    seeds = list(range(4 * NUM_THREADS))
+    sequential = [run(seed) for seed in seeds]
+
+    with ThreadPoolExecutor(max_workers=NUM_THREADS) as executor:
+        concurrent = list(executor.map(run, seeds))
+
+    assert_equal(concurrent, sequential)
+
+
+def test_local_search_per_thread(rc208):
+    """
+    Tests that multiple local search objects sharing the same problem data can
+    search at the same time, and give the same results as sequential searches.
+    """
+    neighbours = compute_neighbours(rc208)
+    cost_eval = CostEvaluator(20, 6, 0)
+
+    def run(seed: int):
+        rng = RandomNumberGenerator(seed=seed)
+        ls = LocalSearch(rc208, rng, neighbours)
+        ls.add_node_operator(Exchange10(rc208))
+        ls.add_node_operator(Exchange11(rc208))
+        ls.add_route_operator(SwapStar(rc208))
+
+        sol = Solution.make_random(rc208, rng)
+        return ls(sol, cost_eval)
+
+    seeds = list(range(NUM_THREADS))
+    sequential = [run(seed) for seed in seeds]
+
+    with ThreadPoolExecutor(max_workers=NUM_THREADS) as executor:
+        concurrent = list(executor.map(run, seeds))
+
+    assert_equal(concurrent, sequential)
+
+
+def test_shared_local_search(rc208):
+    """
+    Tests that a single local search object can safely be used from multiple
+    threads, since its calls are serialised.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    ls = LocalSearch(rc208, rng, compute_neighbours(rc208))
+    ls.add_node_operator(Exchange10(rc208))
+    ls.add_route_operator(SwapStar(rc208))
+
+    cost_eval = CostEvaluator(20, 6, 0)
+    sols = [
+        Solution.make_random(rc208, RandomNumberGenerator(seed))
+        for seed in range(4 * NUM_THREADS)
+    ]
+
+    with ThreadPoolExecutor(max_workers=NUM_THREADS) as executor:
+        improved = list(executor.map(lambda sol: ls(sol, cost_eval), sols))
+
+    for before, after in zip(sols, improved):
+        assert_(after.is_complete())
+        assert_(
+            cost_eval.penalised_cost(after) < cost_eval.penalised_cost(before)
+        )
+
+
+def test_population_per_thread_with_shared_solutions(rc208):
+    """
+    Tests that populations can be used concurrently, also when they contain the
+    same solutions.
+    """
+    rng = RandomNumberGenerator(seed=42)
+    sols = [Solution.make_random(rc208, rng) for _ in range(50)]
+    cost_eval = CostEvaluator(20, 6, 0)
+
+    def run(seed: int):
+        pop = Population(bpd)
+        for sol in sols:
+            pop.add(sol, cost_eval)
+
+        rng = RandomNumberGenerator(seed=seed)
+        parents = [pop.select(rng, cost_eval) for _ in range(100)]
+        return len(pop), parents
+
+    seeds = list(range(NUM_THREADS))
+    sequential = [run(seed) for seed in seeds]
+
+    with ThreadPoolExecutor(max_workers=NUM_THREADS) as executor:
+        concurrent = list(executor.map(run, seeds))
+
+    assert_equal(concurrent, sequential)